@@ -48,6 +48,50 @@ public:
         loadFromJson();
     }
     
+    /**
+     * @brief 바이트 범위에서 역직렬화 (std::string 복사 없음)
+     * 
+     * @param json JSON 시작 위치 ('\0' 종료 불필요)
+     * @param length 바이트 수
+     * 
+     * 큰 버퍼(파일, NDJSON 묶음 등) 안의 레코드 하나를 바로 읽을 때 사용
+     */
+    virtual void fromJson(const char* json, size_t length) {
+        parseFromRange(json, length);
+        loadFromJson();
+    }
+    
+    /**
+     * @brief SAX 이벤트 생성기에서 역직렬화 (JSON 텍스트 파싱 없음)
+     * 
+     * @param accept accept(handler): handler에 JSON 이벤트를 순서대로 전달, 성공 여부 반환
+     * 
+     * 컴파일 타임에 파싱된 리터럴(StaticJson)처럼 이미 구조를 아는 원본에서 사용
+     */
+    template<typename Accept>
+    void fromEvents(Accept&& accept) {
+        populateFromEvents(std::forward<Accept>(accept));
+        loadFromJson();
+    }
+    
+    /**
+     * @brief 쓰기 가능한 버퍼에서 복사 없이 역직렬화 (in-situ)
+     * 
+     * @param json '\0'으로 끝나는 JSON 버퍼 (파싱 중 내용이 덮어써짐)
+     * 
+     * 내부 동작:
+     * 1. 버퍼를 제자리 파싱 (문자열 값은 버퍼를 직접 참조)
+     * 2. loadFromJson() 호출
+     * 3. 버퍼 참조가 남지 않도록 내부 document를 비움
+     * 
+     * 공유 메모리 슬롯처럼 곧 재사용될 버퍼에서 바로 읽을 때 사용
+     */
+    virtual void fromJsonInsitu(char* json) {
+        parseFromBufferInsitu(json);
+        loadFromJson();
+        releaseDocument();
+    }
+    
     /**
      * @brief 내부 JSON 객체에서 데이터 로드 (사용자 구현 필수)
      * 
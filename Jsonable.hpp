@@ -8,9 +8,30 @@
 
 #include "ToJsonable.hpp"
 #include "FromJsonable.hpp"
+#include "JsonableEnum.hpp"
+#include "JsonableMatrix.hpp"
+#include "JsonableBudget.hpp"
+#include "JsonableRope.hpp"
+#include "JsonableIovec.hpp"
+#include "JsonableMinify.hpp"
+#include "JsonableStream.hpp"
+#include "JsonableCollection.hpp"
+#include "JsonableAggregate.hpp"
+#include "JsonableLazy.hpp"
+#include "JsonablePersistent.hpp"
+#include "JsonableStatic.hpp"
+#include "JsonablePrototype.hpp"
 #include <type_traits>
 #include <utility>
 
+// 스레드/OS 자원을 쓰는 런타임 엔진은 여기서 포함하지 않음 (사용하는 곳에서 직접 include)
+// - JsonableParallel.hpp  : toJsonParallel, work-stealing 스레드 풀
+// - JsonableShmRing.hpp   : 프로세스 간 공유 메모리 링 (POSIX shm/mmap)
+// - JsonableFrozen.hpp    : mmap 공유 document 이미지 (POSIX)
+// - JsonableStore.hpp     : append-only 레코드 저장소 (파일, 압축 스레드)
+// - JsonableHotReload.hpp : inotify 감시 스레드 + 스냅샷 교체 (Linux)
+// - JsonableBulkIo.hpp    : io_uring/워커 풀 대량 파일 I/O
+
 namespace json {
 
 // ========================================
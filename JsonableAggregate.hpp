@@ -0,0 +1,427 @@
+#pragma once
+
+/**
+ * JsonableAggregate.hpp - NDJSON 스트리밍 group-by 집계 (완전 inline)
+ *
+ * 역할: NDJSON 줄마다 객체를 만들지 않고 참조된 필드만 스캔하여
+ *       그룹별 count/sum/min/max를 누적, 결과에서 top-k 그룹 선택
+ *       - 필드 추출: FieldScanner (원문 범위만, 필요한 필드를 찾으면 줄 나머지 생략)
+ *       - 누적: 그룹 id + 값 열을 배치로 모은 뒤 metric별 단일 루프로 반영
+ *               (metric 종류 분기는 배치당 한 번, 그룹 열은 metric별 연속 배열)
+ */
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <istream>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "JsonableNumber.hpp"
+#include "JsonableWriter.hpp"
+#include "JsonableScan.hpp"
+
+namespace json {
+
+enum class AggregateOp : uint8_t { Count, Sum, Min, Max };
+
+/**
+ * @brief 집계 결과 한 행
+ *
+ * keys: 그룹 필드 순서 (문자열은 복원된 값, 그 외는 JSON 원문, 없는 필드는 "")
+ * values: metric 선언 순서 (값이 하나도 없던 min/max는 ±inf)
+ */
+struct AggregateRow {
+    std::vector<std::string> keys;
+    std::vector<detail::ScanKind> keyKinds;
+    std::vector<double> values;
+};
+
+/**
+ * @brief NDJSON group-by 집계기
+ *
+ * @code
+ * json::Aggregator report({"region", "http.status"});
+ * const size_t requests = report.addCount();
+ * const size_t bytes = report.addSum("bytes");
+ * report.addMax("latencyMs");
+ *
+ * report.consume(std::cin);                 // 한 줄에 JSON 객체 하나
+ * for (const auto& row : report.top(bytes, 10)) { ... }
+ * std::cout << report.toJson();             // [{"region":"eu","http.status":200,"count":3,...}]
+ * @endcode
+ *
+ * - metric은 첫 consume 전에 선언 (이후 선언은 kNoMetric)
+ * - 숫자가 아니거나 없는 metric 필드는 해당 metric에서만 제외 (count는 줄 수)
+ * - sum/min/max는 double 누적 (정수 합은 2^53까지 정확)
+ */
+class Aggregator {
+public:
+    static constexpr size_t kNoMetric = static_cast<size_t>(-1);
+
+    explicit Aggregator(std::vector<std::string> groupFields) : groupFields_(std::move(groupFields)) {}
+
+    // ========================================
+    // metric 선언
+    // ========================================
+
+    inline size_t addCount() { return addMetric(AggregateOp::Count, std::string()); }
+    inline size_t addSum(const std::string& field) { return addMetric(AggregateOp::Sum, field); }
+    inline size_t addMin(const std::string& field) { return addMetric(AggregateOp::Min, field); }
+    inline size_t addMax(const std::string& field) { return addMetric(AggregateOp::Max, field); }
+
+    // ========================================
+    // 입력
+    // ========================================
+
+    /**
+     * @brief NDJSON 줄 하나 집계
+     *
+     * @return 객체가 아닌 줄이면 false (건너뜀)
+     */
+    inline bool consumeLine(const char* text, size_t length) {
+        start();
+        if (!scanner_->scan(text, length, scanned_.data())) {
+            ++skippedLines_;
+            return false;
+        }
+        ++lineCount_;
+
+        const size_t slot = batchSize_++;
+        batchGroups_[slot] = groupOf(scanned_.data());
+        for (size_t m = 0; m < metrics_.size(); ++m) {
+            const Metric& metric = metrics_[m];
+            batchValues_[m * kBatch + slot] = metric.op == AggregateOp::Count ? 1.0 : metricValue(metric.op, scanned_[metric.column]);
+        }
+        if (batchSize_ == kBatch) flushBatch();
+        return true;
+    }
+
+    /**
+     * @brief NDJSON 버퍼 집계 ('\n' 구분, 빈 줄 무시, 마지막 줄은 개행 없어도 됨)
+     */
+    inline void consume(const char* data, size_t size) {
+        const char* p = data;
+        const char* end = data + size;
+        while (p < end) {
+            const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            const char* lineEnd = newline ? newline : end;
+            consumeRange(p, lineEnd);
+            p = newline ? newline + 1 : end;
+        }
+    }
+
+    /**
+     * @brief 스트림 끝까지 집계 (64KB 단위 읽기, 줄이 경계에 걸치면 이어 붙임)
+     */
+    inline bool consume(std::istream& in) {
+        std::vector<char> buffer(kReadChunk);
+        size_t carried = 0;   // 이전 청크에서 넘어온 미완성 줄 (개행 없음)
+        for (;;) {
+            if (carried == buffer.size()) buffer.resize(buffer.size() * 2);   // 청크보다 긴 줄
+            in.read(buffer.data() + carried, static_cast<std::streamsize>(buffer.size() - carried));
+            const size_t available = carried + static_cast<size_t>(in.gcount());
+            if (!in) {
+                consume(buffer.data(), available);
+                break;
+            }
+
+            // 새로 읽은 부분에서 마지막 개행까지만 처리
+            size_t complete = available;
+            while (complete > carried && buffer[complete - 1] != '\n') --complete;
+            if (complete == carried) complete = 0;
+            consume(buffer.data(), complete);
+            carried = available - complete;
+            if (complete) std::memmove(buffer.data(), buffer.data() + complete, carried);
+        }
+        flushBatch();
+        return !in.bad();
+    }
+
+    // ========================================
+    // 결과
+    // ========================================
+
+    inline size_t lineCount() const { return lineCount_; }
+    inline size_t skippedLines() const { return skippedLines_; }
+
+    inline size_t groupCount() {
+        flushBatch();
+        return groupKeys_.size();
+    }
+
+    inline size_t metricCount() const { return metrics_.size(); }
+
+    /**
+     * @brief 전체 행 (그룹이 처음 나타난 순서)
+     */
+    inline std::vector<AggregateRow> rows() {
+        flushBatch();
+        std::vector<AggregateRow> result;
+        result.reserve(groupKeys_.size());
+        for (uint32_t group = 0; group < groupKeys_.size(); ++group) result.push_back(row(group));
+        return result;
+    }
+
+    /**
+     * @brief metric 값 기준 상위 k개 그룹 (같은 값이면 먼저 나타난 그룹 우선)
+     */
+    inline std::vector<AggregateRow> top(size_t metric, size_t k, bool largest = true) {
+        flushBatch();
+        std::vector<AggregateRow> result;
+        if (metric >= metrics_.size()) return result;
+
+        const std::vector<double>& column = columns_[metric];
+        std::vector<uint32_t> order(groupKeys_.size());
+        for (uint32_t group = 0; group < order.size(); ++group) order[group] = group;
+        k = std::min(k, order.size());
+        std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(k), order.end(),
+                          [&](uint32_t a, uint32_t b) {
+                              if (column[a] != column[b]) return largest ? column[a] > column[b] : column[a] < column[b];
+                              return a < b;
+                          });
+        result.reserve(k);
+        for (size_t i = 0; i < k; ++i) result.push_back(row(order[i]));
+        return result;
+    }
+
+    /**
+     * @brief 결과를 객체 배열 JSON으로 (키 이름: 그룹 필드 경로, "count", "sum(field)" ...)
+     *
+     * 정수 값은 정수로, 값이 없던 min/max는 null로 출력
+     */
+    inline std::string toJson() {
+        flushBatch();
+        rapidjson::StringBuffer buffer;
+        detail::JsonWriter<rapidjson::StringBuffer> writer(buffer);
+        writer.StartArray();
+        for (uint32_t group = 0; group < groupKeys_.size(); ++group) {
+            writer.StartObject();
+            const GroupKey& key = groupKeys_[group];
+            for (size_t f = 0; f < groupFields_.size(); ++f) {
+                writeName(writer, groupFields_[f]);
+                writeKey(writer, key.kinds[f], key.parts[f]);
+            }
+            for (size_t m = 0; m < metrics_.size(); ++m) {
+                writeName(writer, metricName(metrics_[m]));
+                writeNumber(writer, columns_[m][group]);
+            }
+            writer.EndObject();
+        }
+        writer.EndArray();
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+
+    inline void clear() {
+        groups_.clear();
+        groupKeys_.clear();
+        for (auto& column : columns_) column.clear();
+        batchSize_ = 0;
+        lineCount_ = 0;
+        skippedLines_ = 0;
+    }
+
+private:
+    static constexpr size_t kBatch = 256;
+    static constexpr size_t kReadChunk = 64 * 1024;
+
+    struct Metric {
+        AggregateOp op;
+        std::string field;
+        size_t column;   // scanned_ 인덱스 (count는 필드를 읽지 않으므로 사용 안 함)
+    };
+
+    struct GroupKey {
+        std::vector<std::string> parts;
+        std::vector<detail::ScanKind> kinds;
+    };
+
+    inline size_t addMetric(AggregateOp op, const std::string& field) {
+        if (scanner_) return kNoMetric;
+        metrics_.push_back(Metric{op, field, 0});
+        return metrics_.size() - 1;
+    }
+
+    inline void start() {
+        if (scanner_) return;
+        // count는 경로 목록에서 제외 (찾을 수 없는 빈 경로가 있으면 조기 종료가 불가능)
+        std::vector<std::string> paths = groupFields_;
+        for (Metric& metric : metrics_) {
+            if (metric.op == AggregateOp::Count) continue;
+            metric.column = paths.size();
+            paths.push_back(metric.field);
+        }
+        scanner_.reset(new detail::FieldScanner(paths));
+        scanned_.resize(paths.size());
+        batchGroups_.resize(kBatch);
+        batchValues_.resize(metrics_.size() * kBatch);
+        columns_.resize(metrics_.size());
+    }
+
+    inline void consumeRange(const char* p, const char* end) {
+        while (end > p && (end[-1] == '\r' || end[-1] == ' ' || end[-1] == '\t')) --end;
+        p = detail::skipSpace(p, end);
+        if (p < end) consumeLine(p, static_cast<size_t>(end - p));
+    }
+
+    // metric 종류별 항등원 (값이 없는 줄은 결과를 바꾸지 않음)
+    static inline double identity(AggregateOp op) {
+        switch (op) {
+            case AggregateOp::Min: return std::numeric_limits<double>::infinity();
+            case AggregateOp::Max: return -std::numeric_limits<double>::infinity();
+            default: return 0.0;
+        }
+    }
+
+    static inline double metricValue(AggregateOp op, const detail::ScanValue& value) {
+        if (value.kind != detail::ScanKind::Number) return identity(op);
+        detail::ParsedNumber number;
+        if (!detail::parseNumber(value.text, value.length, number)) return identity(op);
+        switch (number.kind) {
+            case detail::ParsedNumber::Kind::Int64: return static_cast<double>(number.i);
+            case detail::ParsedNumber::Kind::UInt64: return static_cast<double>(number.u);
+            default: return number.d;
+        }
+    }
+
+    /**
+     * @brief 그룹 필드 값으로 그룹 id 조회/생성
+     *
+     * 해시 키는 (종류, 길이, 원문) 연결 → 문자열 "200"과 숫자 200은 다른 그룹
+     */
+    inline uint32_t groupOf(const detail::ScanValue* values) {
+        keyBuffer_.clear();
+        for (size_t f = 0; f < groupFields_.size(); ++f) {
+            const detail::ScanValue& value = values[f];
+            const uint32_t length = static_cast<uint32_t>(value.length);
+            keyBuffer_ += static_cast<char>(value.kind);
+            keyBuffer_.append(reinterpret_cast<const char*>(&length), sizeof(length));
+            keyBuffer_.append(value.text ? value.text : "", value.length);
+        }
+
+        const auto it = groups_.find(keyBuffer_);
+        if (it != groups_.end()) return it->second;
+
+        const uint32_t group = static_cast<uint32_t>(groupKeys_.size());
+        GroupKey key;
+        for (size_t f = 0; f < groupFields_.size(); ++f) {
+            const detail::ScanValue& value = values[f];
+            std::string part;
+            if (value.kind == detail::ScanKind::String && value.escaped) {
+                if (!detail::unescapeString(value.text, value.length, part)) part.assign(value.text, value.length);
+            } else if (value.text) {
+                part.assign(value.text, value.length);
+            }
+            key.parts.push_back(std::move(part));
+            key.kinds.push_back(value.kind);
+        }
+        groupKeys_.push_back(std::move(key));
+        groups_.emplace(keyBuffer_, group);
+        for (size_t m = 0; m < metrics_.size(); ++m) columns_[m].push_back(identity(metrics_[m].op));
+        return group;
+    }
+
+    // 배치 반영: metric마다 종류 분기 한 번 + 분기 없는 누적 루프
+    inline void flushBatch() {
+        const size_t count = batchSize_;
+        batchSize_ = 0;
+        if (count == 0) return;
+        const uint32_t* groups = batchGroups_.data();
+        for (size_t m = 0; m < metrics_.size(); ++m) {
+            double* column = columns_[m].data();
+            const double* values = batchValues_.data() + m * kBatch;
+            switch (metrics_[m].op) {
+                case AggregateOp::Count:
+                case AggregateOp::Sum:
+                    for (size_t i = 0; i < count; ++i) column[groups[i]] += values[i];
+                    break;
+                case AggregateOp::Min:
+                    for (size_t i = 0; i < count; ++i) column[groups[i]] = std::min(column[groups[i]], values[i]);
+                    break;
+                case AggregateOp::Max:
+                    for (size_t i = 0; i < count; ++i) column[groups[i]] = std::max(column[groups[i]], values[i]);
+                    break;
+            }
+        }
+    }
+
+    inline AggregateRow row(uint32_t group) const {
+        AggregateRow result;
+        result.keys = groupKeys_[group].parts;
+        result.keyKinds = groupKeys_[group].kinds;
+        result.values.reserve(metrics_.size());
+        for (size_t m = 0; m < metrics_.size(); ++m) result.values.push_back(columns_[m][group]);
+        return result;
+    }
+
+    static inline std::string metricName(const Metric& metric) {
+        switch (metric.op) {
+            case AggregateOp::Count: return "count";
+            case AggregateOp::Sum: return "sum(" + metric.field + ")";
+            case AggregateOp::Min: return "min(" + metric.field + ")";
+            default: return "max(" + metric.field + ")";
+        }
+    }
+
+    template<typename Writer>
+    static inline void writeName(Writer& writer, const std::string& name) {
+        writer.Key(name.c_str(), static_cast<rapidjson::SizeType>(name.size()));
+    }
+
+    template<typename Writer>
+    static inline void writeKey(Writer& writer, detail::ScanKind kind, const std::string& part) {
+        switch (kind) {
+            case detail::ScanKind::Missing:
+                writer.Null();
+                break;
+            case detail::ScanKind::String:
+                writer.String(part.c_str(), static_cast<rapidjson::SizeType>(part.size()));
+                break;
+            default:
+                writer.RawValue(part.c_str(), part.size(),
+                                kind == detail::ScanKind::Object ? rapidjson::kObjectType
+                                : kind == detail::ScanKind::Array ? rapidjson::kArrayType
+                                : rapidjson::kNumberType);
+                break;
+        }
+    }
+
+    template<typename Writer>
+    static inline void writeNumber(Writer& writer, double value) {
+        if (std::isinf(value)) {
+            writer.Null();
+        } else if (value == std::trunc(value) && std::fabs(value) < 9007199254740992.0) {
+            writer.Int64(static_cast<int64_t>(value));
+        } else {
+            writer.Double(value);
+        }
+    }
+
+    std::vector<std::string> groupFields_;
+    std::vector<Metric> metrics_;
+    std::unique_ptr<detail::FieldScanner> scanner_;
+    std::vector<detail::ScanValue> scanned_;
+
+    std::unordered_map<std::string, uint32_t> groups_;
+    std::vector<GroupKey> groupKeys_;
+    std::string keyBuffer_;
+    std::vector<std::vector<double>> columns_;   // [metric][group]
+
+    std::vector<uint32_t> batchGroups_;
+    std::vector<double> batchValues_;            // [metric * kBatch + slot]
+    size_t batchSize_ = 0;
+
+    size_t lineCount_ = 0;
+    size_t skippedLines_ = 0;
+};
+
+} // namespace json
@@ -7,10 +7,13 @@
  */
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <array>
 #include <optional>
 #include <functional>
 #include <cstdint>
+#include <cmath>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -20,8 +23,29 @@
 #include <rapidjson/writer.h>
 #include <rapidjson/stringbuffer.h>
 
+#include "JsonablePacked.hpp"
+#include "JsonableWriter.hpp"
+#include "JsonableUuid.hpp"
+
 namespace json {
 
+// ========================================
+// 선택 기능 전방 선언
+// ========================================
+// 템플릿 멤버에서만 쓰이므로 정의는 사용하는 쪽에서 해당 헤더로 포함
+// (Jsonable.hpp는 모두 포함)
+
+template<typename T> struct Matrix;      // JsonableMatrix.hpp
+class RopeBuffer;                        // JsonableRope.hpp
+class IovecBuffer;                       // JsonableIovec.hpp (POSIX)
+
+namespace detail {
+template<typename E> class EnumTable;    // JsonableEnum.hpp
+class BudgetWriter;                      // JsonableBudget.hpp
+class IovecWriter;                       // JsonableIovec.hpp (POSIX)
+class ParallelSerializer;                // JsonableParallel.hpp
+} // namespace detail
+
 // ========================================
 // 타입 트레이트 (컴파일 타임 타입 검증)
 // ========================================
@@ -41,6 +65,25 @@ constexpr bool is_json_primitive_v = std::disjunction_v<
     std::is_same<T, uint64_t>
 >;
 
+namespace detail {
+
+/**
+ * @brief 호출자 소유 연속 버퍼 참조 (setArray(key, data, count)용 범위)
+ */
+template<typename T>
+struct ArrayView {
+    using value_type = T;
+
+    const T* data_;
+    size_t size_;
+
+    inline const T* begin() const { return data_; }
+    inline const T* end() const { return data_ + size_; }
+    inline size_t size() const { return size_; }
+};
+
+} // namespace detail
+
 /**
  * @brief 기본 JSON 조작 클래스 - RapidJSON 구현 캡슐화
  * 
@@ -62,6 +105,18 @@ private:
         std::string key;
     };
     std::vector<JsonContext> contextStack_;
+    
+    // 루트 멤버 숫자 배열의 packed 버퍼 (document에는 빈 배열 자리표시자)
+    // setArray와 파싱 경로가 채우고 getArray/직렬화가 직접 읽음
+    detail::PackedArrayMap packedArrays_;
+    
+    // 루트 멤버 고정 소수점 숫자의 정확한 값 (document에는 double 근사값)
+    // setDecimal(과 보존 모드의 파싱 경로)이 채우고 getDecimal/직렬화가 직접 읽음
+    detail::DecimalMap decimals_;
+    bool preserveDecimals_ = false;
+    
+    // 기본 모드 파싱에서 수집한 루트 10진수 원문 값 (getDecimal 전용, 출력에는 쓰지 않음)
+    detail::DecimalMap parsedDecimals_;
 
 protected:
     // 파생 클래스에서만 생성/소멸 가능
@@ -72,17 +127,25 @@ protected:
     virtual ~JsonableBase() = default;
     
     // 복사/이동 (RapidJSON document 처리)
-    JsonableBase(const JsonableBase& other) : document_() {
+    JsonableBase(const JsonableBase& other)
+        : document_(), packedArrays_(other.packedArrays_), decimals_(other.decimals_),
+          preserveDecimals_(other.preserveDecimals_), parsedDecimals_(other.parsedDecimals_) {
         document_.CopyFrom(other.document_, document_.GetAllocator());
         // contextStack_는 복사하지 않음 (런타임 상태)
     }
     
     JsonableBase(JsonableBase&& other) noexcept 
-        : document_(std::move(other.document_)), contextStack_(std::move(other.contextStack_)) {}
+        : document_(std::move(other.document_)), contextStack_(std::move(other.contextStack_)),
+          packedArrays_(std::move(other.packedArrays_)), decimals_(std::move(other.decimals_)),
+          preserveDecimals_(other.preserveDecimals_), parsedDecimals_(std::move(other.parsedDecimals_)) {}
     
     JsonableBase& operator=(const JsonableBase& other) {
         if (this != &other) {
             document_.CopyFrom(other.document_, document_.GetAllocator());
+            packedArrays_ = other.packedArrays_;
+            decimals_ = other.decimals_;
+            preserveDecimals_ = other.preserveDecimals_;
+            parsedDecimals_ = other.parsedDecimals_;
             contextStack_.clear(); // 컨텍스트는 초기화
         }
         return *this;
@@ -92,9 +155,24 @@ protected:
         if (this != &other) {
             document_ = std::move(other.document_);
             contextStack_ = std::move(other.contextStack_);
+            packedArrays_ = std::move(other.packedArrays_);
+            decimals_ = std::move(other.decimals_);
+            preserveDecimals_ = other.preserveDecimals_;
+            parsedDecimals_ = std::move(other.parsedDecimals_);
         }
         return *this;
     }
+    
+    /**
+     * @brief 파싱한 루트 고정 소수점 숫자의 원문 10진수 보존 (생성자에서 호출)
+     *
+     * 켜면 toJson도 원문 표기(1.50)를 유지함
+     * 기본은 꺼짐: 파싱 결과는 일반 document 경로로 출력 (1.50 → 1.5)
+     * getDecimal은 두 모드 모두 원문에서 변환
+     */
+    inline void preserveParsedDecimals(bool enable = true) {
+        preserveDecimals_ = enable;
+    }
 
 public:
     // ========================================
@@ -167,105 +245,89 @@ public:
         return defaultValue;
     }
     
+    /**
+     * @brief 문자열 필드를 enum으로 읽기 (EnumTraits<E> 필요)
+     *
+     * 완전 해시 조회 + 문자열 비교 1회, 없거나 모르는 이름이면 defaultValue
+     */
+    template<typename E>
+    inline E getEnum(const char* key, E defaultValue = E{}) const {
+        if (document_.HasMember(key) && document_[key].IsString()) {
+            const auto& value = document_[key];
+            E result = defaultValue;
+            if (detail::EnumTable<E>::decode(value.GetString(), value.GetStringLength(), result)) {
+                return result;
+            }
+        }
+        return defaultValue;
+    }
+    
+    /**
+     * @brief UUID 문자열 필드를 16바이트로 읽기 (없거나 형식이 틀리면 defaultValue)
+     */
+    inline Uuid getUuid(const char* key, const Uuid& defaultValue = Uuid{}) const {
+        if (document_.HasMember(key) && document_[key].IsString()) {
+            const auto& value = document_[key];
+            Uuid result;
+            if (detail::parseUuid(value.GetString(), value.GetStringLength(), result)) {
+                return result;
+            }
+        }
+        return defaultValue;
+    }
+    
+    /**
+     * @brief 숫자 필드를 scale 자리 고정 소수점 정수로 읽기 (123.45, scale 2 → 12345)
+     *
+     * - setDecimal 또는 파싱으로 들어온 루트 숫자: 원문 10진수에서 직접 변환
+     * - 정수: 10^scale 배
+     * - 그 외 double(지수 표기 등): 가장 가까운 값으로 반올림
+     * 자릿수를 줄일 때는 0에서 먼 쪽으로 반올림, int64 범위를 넘거나 scale이 0..18 밖이면 defaultValue
+     */
+    inline int64_t getDecimal(const char* key, int scale, int64_t defaultValue = 0) const {
+        if (!document_.HasMember(key) || !document_[key].IsNumber()) return defaultValue;
+        
+        int64_t result = 0;
+        const auto* decimal = findDecimal(key);
+        if (!decimal && !parsedDecimals_.empty()) {
+            auto it = parsedDecimals_.find(key);
+            if (it != parsedDecimals_.end()) decimal = &it->second;
+        }
+        if (decimal) {
+            return detail::rescaleDecimal(*decimal, scale, result) ? result : defaultValue;
+        }
+        
+        const auto& value = document_[key];
+        if (value.IsInt64()) {
+            return detail::rescaleDecimal(detail::Decimal{value.GetInt64(), 0}, scale, result) ? result : defaultValue;
+        }
+        if (value.IsUint64()) {
+            return defaultValue;   // INT64_MAX 초과
+        }
+        
+        if (scale < 0 || scale > detail::kMaxDecimalDigits) return defaultValue;
+        const double scaled = value.GetDouble() * static_cast<double>(detail::decimalPow10(scale));
+        if (!(scaled > -9.2e18 && scaled < 9.2e18)) return defaultValue;
+        return static_cast<int64_t>(std::llround(scaled));
+    }
+    
     // ========================================
     // 기본 타입 쓰기 (컨텍스트 자동 인식)
     // ========================================
     
     inline void setString(const char* key, const std::string& value) {
-        auto& allocator = document_.GetAllocator();
-        rapidjson::Value valueVal(value.c_str(), allocator);
-        
-        if (contextStack_.empty()) {
-            // 루트 레벨 - 기존 방식
-            ensureObject();
-            rapidjson::Value keyVal(key, allocator);
-            
-            if (document_.HasMember(key)) {
-                document_[key] = std::move(valueVal);
-            } else {
-                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
-            }
-        } else {
-            // 컨텍스트 내부
-            auto* current = getCurrentContext();
-            
-            if (contextStack_.back().isArray) {
-                // 배열 컨텍스트: key 무시하고 배열에 추가
-                current->PushBack(std::move(valueVal), allocator);
-            } else {
-                // 객체 컨텍스트: key를 사용하여 필드 설정
-                if (key && strlen(key) > 0) {
-                    rapidjson::Value keyVal(key, allocator);
-                    if (current->HasMember(key)) {
-                        (*current)[key] = std::move(valueVal);
-                    } else {
-                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
-                    }
-                }
-            }
-        }
+        rapidjson::Value valueVal(value.c_str(), document_.GetAllocator());
+        setValueInContext(key, valueVal);
     }
     
     inline void setInt64(const char* key, int64_t value) {
-        auto& allocator = document_.GetAllocator();
         rapidjson::Value valueVal(value);
-        
-        if (contextStack_.empty()) {
-            ensureObject();
-            rapidjson::Value keyVal(key, allocator);
-            
-            if (document_.HasMember(key)) {
-                document_[key] = std::move(valueVal);
-            } else {
-                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
-            }
-        } else {
-            auto* current = getCurrentContext();
-            
-            if (contextStack_.back().isArray) {
-                current->PushBack(std::move(valueVal), allocator);
-            } else {
-                if (key && strlen(key) > 0) {
-                    rapidjson::Value keyVal(key, allocator);
-                    if (current->HasMember(key)) {
-                        (*current)[key] = std::move(valueVal);
-                    } else {
-                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
-                    }
-                }
-            }
-        }
+        setValueInContext(key, valueVal);
     }
     
     inline void setDouble(const char* key, double value) {
-        auto& allocator = document_.GetAllocator();
         rapidjson::Value valueVal(value);
-        
-        if (contextStack_.empty()) {
-            ensureObject();
-            rapidjson::Value keyVal(key, allocator);
-            
-            if (document_.HasMember(key)) {
-                document_[key] = std::move(valueVal);
-            } else {
-                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
-            }
-        } else {
-            auto* current = getCurrentContext();
-            
-            if (contextStack_.back().isArray) {
-                current->PushBack(std::move(valueVal), allocator);
-            } else {
-                if (key && strlen(key) > 0) {
-                    rapidjson::Value keyVal(key, allocator);
-                    if (current->HasMember(key)) {
-                        (*current)[key] = std::move(valueVal);
-                    } else {
-                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
-                    }
-                }
-            }
-        }
+        setValueInContext(key, valueVal);
     }
     
     inline void setFloat(const char* key, float value) {
@@ -273,96 +335,69 @@ public:
     }
     
     inline void setBool(const char* key, bool value) {
-        auto& allocator = document_.GetAllocator();
         rapidjson::Value valueVal(value);
-        
-        if (contextStack_.empty()) {
-            ensureObject();
-            rapidjson::Value keyVal(key, allocator);
-            
-            if (document_.HasMember(key)) {
-                document_[key] = std::move(valueVal);
-            } else {
-                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
-            }
-        } else {
-            auto* current = getCurrentContext();
-            
-            if (contextStack_.back().isArray) {
-                current->PushBack(std::move(valueVal), allocator);
-            } else {
-                if (key && strlen(key) > 0) {
-                    rapidjson::Value keyVal(key, allocator);
-                    if (current->HasMember(key)) {
-                        (*current)[key] = std::move(valueVal);
-                    } else {
-                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
-                    }
-                }
-            }
-        }
+        setValueInContext(key, valueVal);
     }
     
     inline void setUInt32(const char* key, uint32_t value) {
-        auto& allocator = document_.GetAllocator();
         rapidjson::Value valueVal(value);
-        
-        if (contextStack_.empty()) {
-            ensureObject();
-            rapidjson::Value keyVal(key, allocator);
-            
-            if (document_.HasMember(key)) {
-                document_[key] = std::move(valueVal);
-            } else {
-                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
-            }
-        } else {
-            auto* current = getCurrentContext();
-            
-            if (contextStack_.back().isArray) {
-                current->PushBack(std::move(valueVal), allocator);
-            } else {
-                if (key && strlen(key) > 0) {
-                    rapidjson::Value keyVal(key, allocator);
-                    if (current->HasMember(key)) {
-                        (*current)[key] = std::move(valueVal);
-                    } else {
-                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
-                    }
-                }
-            }
-        }
+        setValueInContext(key, valueVal);
     }
     
     inline void setUInt64(const char* key, uint64_t value) {
-        auto& allocator = document_.GetAllocator();
         rapidjson::Value valueVal(value);
+        setValueInContext(key, valueVal);
+    }
+    
+    /**
+     * @brief enum을 이름 문자열로 쓰기 (EnumTraits<E> 필요)
+     *
+     * 이름은 정적 리터럴 참조로 저장 (할당/복사 없음), 목록에 없는 값은 null
+     */
+    template<typename E>
+    inline void setEnum(const char* key, E value) {
+        const std::string_view name = detail::EnumTable<E>::encode(value);
+        rapidjson::Value valueVal;
+        if (!name.empty()) {
+            valueVal.SetString(rapidjson::StringRef(name.data(), static_cast<rapidjson::SizeType>(name.size())));
+        }
+        setValueInContext(key, valueVal);
+    }
+    
+    /**
+     * @brief UUID를 36자 소문자 문자열로 쓰기 (컨텍스트 자동 인식)
+     *
+     * 스택 버퍼에 바로 포맷하여 document 문자열로 한 번만 복사
+     */
+    inline void setUuid(const char* key, const Uuid& value) {
+        char text[detail::kUuidTextLength];
+        detail::formatUuid(value, text);
+        rapidjson::Value valueVal(text, static_cast<rapidjson::SizeType>(sizeof(text)), document_.GetAllocator());
+        setValueInContext(key, valueVal);
+    }
+    
+    /**
+     * @brief mantissa / 10^scale 값을 scale 자리 그대로 쓰기 (12345, 2 → 123.45)
+     *
+     * 출력 텍스트는 double을 거치지 않음 (document에는 getDouble용 근사값)
+     * 정확한 값은 루트 객체 멤버만 보관하므로 기록 위치는 루트 또는 키 없는 beginObject() 컨텍스트
+     * 중첩 객체/배열 컨텍스트이거나 scale이 0..18 밖이면 null을 쓰고 false 반환
+     */
+    inline bool setDecimal(const char* key, int64_t mantissa, int scale) {
+        const bool atRoot = contextStack_.empty() ||
+                            (!contextStack_.back().isArray && contextStack_.back().current == &document_);
+        const bool valid = atRoot && key && *key && scale >= 0 && scale <= detail::kMaxDecimalDigits;
         
-        if (contextStack_.empty()) {
-            ensureObject();
-            rapidjson::Value keyVal(key, allocator);
-            
-            if (document_.HasMember(key)) {
-                document_[key] = std::move(valueVal);
-            } else {
-                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
-            }
-        } else {
-            auto* current = getCurrentContext();
-            
-            if (contextStack_.back().isArray) {
-                current->PushBack(std::move(valueVal), allocator);
-            } else {
-                if (key && strlen(key) > 0) {
-                    rapidjson::Value keyVal(key, allocator);
-                    if (current->HasMember(key)) {
-                        (*current)[key] = std::move(valueVal);
-                    } else {
-                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
-                    }
-                }
-            }
+        rapidjson::Value valueVal;
+        if (valid) {
+            valueVal.SetDouble(static_cast<double>(mantissa) / static_cast<double>(detail::decimalPow10(scale)));
         }
+        setValueInContext(key, valueVal);
+        
+        if (valid) {
+            decimals_[key] = detail::Decimal{mantissa, static_cast<int32_t>(scale)};
+        }
+        return valid;
     }
     
     // ========================================
@@ -375,6 +410,11 @@ public:
         static_assert(is_json_primitive_v<T>, 
                      "Array elements must be JSON primitive types only");
         
+        // packed 배열: 같은 요소 타입이면 연속 버퍼 memcpy
+        if (const auto* packed = findPacked(key)) {
+            return packed->template as<T>();
+        }
+        
         std::vector<T> result;
         
         if (document_.HasMember(key) && document_[key].IsArray()) {
@@ -387,26 +427,132 @@ public:
         return result;
     }
     
+    /**
+     * @brief 고정 길이 배열로 읽기 (할당 없음)
+     *
+     * @return 배열이 있고 길이가 정확히 N이면 true, 아니면 false (out 변경 없음)
+     */
+    template<typename T, size_t N>
+    inline bool getArray(const char* key, std::array<T, N>& out) const {
+        return getArray(key, out.data(), N);
+    }
+    
+    /**
+     * @brief 호출자 버퍼 out[0..count) 에 읽기 (할당 없음)
+     *
+     * @return 배열이 있고 길이가 정확히 count이면 true, 아니면 false (out 변경 없음)
+     */
     template<typename T>
-    inline void setArray(const char* key, const std::vector<T>& values) {
-        // 타입 안전성 보장: JSON 기본 타입만 허용
+    inline bool getArray(const char* key, T* out, size_t count) const {
         static_assert(is_json_primitive_v<T>, 
                      "Array elements must be JSON primitive types only");
         
-        ensureObject();
+        if (const auto* packed = findPacked(key)) {
+            if (packed->size() != count) return false;
+            packed->copyTo(out);
+            return true;
+        }
         
-        rapidjson::Value array(rapidjson::kArrayType);
-        auto& allocator = document_.GetAllocator();
+        if (!document_.HasMember(key) || !document_[key].IsArray()) return false;
+        const auto& array = document_[key];
+        if (array.Size() != count) return false;
         
-        for (const auto& value : values) {
-            array.PushBack(convertToValue(value), allocator);
+        for (rapidjson::SizeType i = 0; i < array.Size(); ++i) {
+            out[i] = convertFromValue<T>(array[i]);
         }
+        return true;
+    }
+    
+    template<typename T>
+    inline void setArray(const char* key, const std::vector<T>& values) {
+        setArrayRange(key, values);
+    }
+    
+    template<typename T, size_t N>
+    inline void setArray(const char* key, const std::array<T, N>& values) {
+        setArrayRange(key, values);
+    }
+    
+    /**
+     * @brief 호출자 버퍼 data[0..count) 를 배열로 쓰기
+     */
+    template<typename T>
+    inline void setArray(const char* key, const T* data, size_t count) {
+        setArrayRange(key, detail::ArrayView<T>{data, count});
+    }
+    
+    // ========================================
+    // 다차원 숫자 배열 (연속 버퍼 + shape)
+    // ========================================
+    
+    /**
+     * @brief 직사각형 중첩 숫자 배열을 Matrix로 읽기
+     *
+     * shape는 첫 요소를 따라 내려가며 결정하고, 모든 하위 배열 길이와
+     * 말단 숫자 여부를 검증함. 들쭉날쭉하거나 숫자가 아닌 요소가 있으면 빈 Matrix
+     */
+    template<typename T>
+    inline Matrix<T> getMatrix(const char* key) const {
+        static_assert(detail::PackedArray::isPackable<T>,
+                     "Matrix elements must be numeric types");
         
-        if (document_.HasMember(key)) {
-            document_[key] = std::move(array);
-        } else {
-            document_.AddMember(rapidjson::Value(key, allocator), std::move(array), allocator);
+        Matrix<T> result;
+        if (!document_.HasMember(key)) return result;
+        
+        // 1차원 packed 배열
+        if (const auto* packed = findPacked(key)) {
+            result.shape.push_back(packed->size());
+            result.data = packed->template as<T>();
+            return result;
         }
+        
+        const rapidjson::Value* probe = &document_[key];
+        while (probe->IsArray()) {
+            result.shape.push_back(probe->Size());
+            if (probe->Size() == 0) break;
+            probe = probe->Begin();
+        }
+        
+        result.data.reserve(Matrix<T>::elementCount(result.shape));
+        if (!decodeMatrix(document_[key], 0, result)) {
+            return Matrix<T>();
+        }
+        return result;
+    }
+    
+    /**
+     * @brief Matrix를 중첩 배열로 쓰기 (컨텍스트 자동 인식)
+     *
+     * shape와 data 크기가 맞지 않으면 null
+     */
+    template<typename T>
+    inline void setMatrix(const char* key, const Matrix<T>& matrix) {
+        setMatrix(key, matrix.shape, matrix.data.data(), matrix.data.size());
+    }
+    
+    /**
+     * @brief 호출자 버퍼 data[0..count) 를 shape에 따라 중첩 배열로 쓰기
+     */
+    template<typename T>
+    inline void setMatrix(const char* key, const std::vector<size_t>& shape, const T* data, size_t count) {
+        static_assert(detail::PackedArray::isPackable<T>,
+                     "Matrix elements must be numeric types");
+        
+        if (Matrix<T>::elementCount(shape) != count) {
+            rapidjson::Value null;
+            setValueInContext(key, null);
+            return;
+        }
+        
+        // 루트의 1차원 배열은 setArray 경로 (packed 저장소 사용)
+        if (contextStack_.empty() && shape.size() == 1) {
+            setArrayRange(key, detail::ArrayView<T>{data, count});
+            return;
+        }
+        
+        const T* cursor = data;
+        rapidjson::Value valueVal = encodeMatrix(shape, 0, cursor);
+        setValueInContext(key, valueVal);
     }
     
     // ========================================
@@ -431,8 +577,9 @@ public:
     
     inline void iterateArray(const char* key, std::function<void(size_t index)> processor) const {
         if (document_.HasMember(key) && document_[key].IsArray()) {
-            const auto& array = document_[key];
-            for (size_t i = 0; i < array.Size(); ++i) {
+            const auto* packed = findPacked(key);
+            const size_t size = packed ? packed->size() : document_[key].Size();
+            for (size_t i = 0; i < size; ++i) {
                 processor(i);
             }
         }
@@ -459,6 +606,7 @@ public:
         
         if (contextStack_.empty()) {
             if (key) {
+                dropSideEntries(key);
                 rapidjson::Value newObj(rapidjson::kObjectType);
                 rapidjson::Value keyVal(key, allocator);
                 document_.AddMember(keyVal, newObj, allocator);
@@ -475,6 +623,7 @@ public:
                 targetObject = &(*current)[current->Size() - 1];
             } else {
                 if (key) {
+                    if (current == &document_) dropSideEntries(key);
                     rapidjson::Value keyVal(key, allocator);
                     current->AddMember(keyVal, newObj, allocator);
                     targetObject = &(*current)[key];
@@ -501,6 +650,7 @@ public:
         
         if (contextStack_.empty()) {
             if (key) {
+                dropSideEntries(key);
                 rapidjson::Value newArray(rapidjson::kArrayType);
                 rapidjson::Value keyVal(key, allocator);
                 document_.AddMember(keyVal, newArray, allocator);
@@ -515,6 +665,7 @@ public:
                 targetArray = &(*current)[current->Size() - 1];
             } else {
                 if (key) {
+                    if (current == &document_) dropSideEntries(key);
                     rapidjson::Value keyVal(key, allocator);
                     current->AddMember(keyVal, newArray, allocator);
                     targetArray = &(*current)[key];
@@ -614,20 +765,247 @@ protected:
         contextStack_.push_back({value, isArray, key});
     }
     
+    // 컨텍스트 자동 인식 값 설정 (모든 setXX 공통 경로)
+    inline void setValueInContext(const char* key, rapidjson::Value& valueVal) {
+        auto& allocator = document_.GetAllocator();
+        
+        if (contextStack_.empty()) {
+            // 루트 레벨 - 기존 방식
+            ensureObject();
+            
+            if (document_.HasMember(key)) {
+                dropSideEntries(key);
+                document_[key] = std::move(valueVal);
+            } else {
+                rapidjson::Value keyVal(key, allocator);
+                document_.AddMember(std::move(keyVal), std::move(valueVal), allocator);
+            }
+        } else {
+            // 컨텍스트 내부
+            auto* current = getCurrentContext();
+            
+            if (contextStack_.back().isArray) {
+                // 배열 컨텍스트: key 무시하고 배열에 추가
+                current->PushBack(std::move(valueVal), allocator);
+            } else {
+                // 객체 컨텍스트: key를 사용하여 필드 설정
+                if (key && strlen(key) > 0) {
+                    rapidjson::Value keyVal(key, allocator);
+                    if (current->HasMember(key)) {
+                        // 키 없는 beginObject()는 루트 document 자체가 컨텍스트
+                        if (current == &document_) dropSideEntries(key);
+                        (*current)[key] = std::move(valueVal);
+                    } else {
+                        current->AddMember(std::move(keyVal), std::move(valueVal), allocator);
+                    }
+                }
+            }
+        }
+    }
+    
+    // 연속 요소 범위 → 루트 배열 (vector / std::array / ArrayView 공통 경로)
+    template<typename Range>
+    inline void setArrayRange(const char* key, const Range& values) {
+        using T = typename Range::value_type;
+        
+        // 타입 안전성 보장: JSON 기본 타입만 허용
+        static_assert(is_json_primitive_v<T>, 
+                     "Array elements must be JSON primitive types only");
+        
+        ensureObject();
+        
+        rapidjson::Value array(rapidjson::kArrayType);
+        auto& allocator = document_.GetAllocator();
+        
+        // 큰 숫자 배열: 요소별 Value 대신 packed 버퍼에 통째로 복사
+        detail::PackedArray packed;
+        bool usePacked = false;
+        if constexpr (detail::PackedArray::isPackable<T>) {
+            usePacked = values.size() >= detail::PackedArray::kMinElements &&
+                        detail::PackedArray::from(values, packed);
+        }
+        
+        if (!usePacked) {
+            array.Reserve(static_cast<rapidjson::SizeType>(values.size()), allocator);
+            for (const auto& value : values) {
+                array.PushBack(convertToValue(value), allocator);
+            }
+        }
+        
+        if (document_.HasMember(key)) {
+            dropSideEntries(key);
+            document_[key] = std::move(array);
+        } else {
+            document_.AddMember(rapidjson::Value(key, allocator), std::move(array), allocator);
+        }
+        
+        if (usePacked) {
+            packedArrays_[key] = std::move(packed);
+        }
+    }
+    
+    // 중첩 배열 → 연속 버퍼 (shape 검증하며 row-major 순서로 추가)
+    template<typename T>
+    inline bool decodeMatrix(const rapidjson::Value& value, size_t depth, Matrix<T>& out) const {
+        if (depth == out.shape.size()) {
+            if (!value.IsNumber()) return false;
+            out.data.push_back(convertFromValue<T>(value));
+            return true;
+        }
+        if (!value.IsArray() || value.Size() != out.shape[depth]) return false;
+        for (const auto& element : value.GetArray()) {
+            if (!decodeMatrix(element, depth + 1, out)) return false;
+        }
+        return true;
+    }
+    
+    // 연속 버퍼 → 중첩 배열 (cursor는 소비한 만큼 전진)
+    template<typename T>
+    inline rapidjson::Value encodeMatrix(const std::vector<size_t>& shape, size_t depth, const T*& cursor) {
+        if (depth == shape.size()) {
+            return convertToValue(*cursor++);
+        }
+        auto& allocator = document_.GetAllocator();
+        rapidjson::Value array(rapidjson::kArrayType);
+        array.Reserve(static_cast<rapidjson::SizeType>(shape[depth]), allocator);
+        for (size_t i = 0; i < shape[depth]; ++i) {
+            array.PushBack(encodeMatrix(shape, depth + 1, cursor), allocator);
+        }
+        return array;
+    }
+    
+    // 루트 멤버 부가 저장소(packed 배열/10진수) 조회/제거 (비어 있으면 비용 없음)
+    inline const detail::PackedArray* findPacked(const char* key) const {
+        if (packedArrays_.empty()) return nullptr;
+        auto it = packedArrays_.find(key);
+        return it != packedArrays_.end() ? &it->second : nullptr;
+    }
+    
+    inline const detail::Decimal* findDecimal(const char* key) const {
+        if (decimals_.empty()) return nullptr;
+        auto it = decimals_.find(key);
+        return it != decimals_.end() ? &it->second : nullptr;
+    }
+    
+    inline void dropSideEntries(const char* key) {
+        if (!packedArrays_.empty()) {
+            auto it = packedArrays_.find(key);
+            if (it != packedArrays_.end()) packedArrays_.erase(it);
+        }
+        if (!decimals_.empty()) {
+            auto it = decimals_.find(key);
+            if (it != decimals_.end()) decimals_.erase(it);
+        }
+        if (!parsedDecimals_.empty()) {
+            auto it = parsedDecimals_.find(key);
+            if (it != parsedDecimals_.end()) parsedDecimals_.erase(it);
+        }
+    }
+    
+    // document 전체를 SAX 핸들러로 출력 (packed 배열은 버퍼에서 직접 출력)
+    template<typename Handler>
+    inline bool acceptDocument(Handler& handler) const {
+        if ((packedArrays_.empty() && decimals_.empty()) || !document_.IsObject()) {
+            return document_.Accept(handler);
+        }
+        
+        if (!handler.StartObject()) return false;
+        for (auto it = document_.MemberBegin(); it != document_.MemberEnd(); ++it) {
+            if (!handler.Key(it->name.GetString(), it->name.GetStringLength(), false)) return false;
+            const auto* packed = it->value.IsArray() ? findPacked(it->name.GetString()) : nullptr;
+            const auto* decimal = it->value.IsNumber() ? findDecimal(it->name.GetString()) : nullptr;
+            bool ok;
+            if (packed) {
+                ok = packed->write(handler);
+            } else if (decimal) {
+                char text[detail::kDecimalTextCapacity];
+                ok = handler.RawNumber(text, static_cast<rapidjson::SizeType>(detail::formatDecimal(*decimal, text)), true);
+            } else {
+                ok = it->value.Accept(handler);
+            }
+            if (!ok) return false;
+        }
+        return handler.EndObject(document_.MemberCount());
+    }
+    
     // JSON 문자열 변환
     inline std::string documentToString() const {
         rapidjson::StringBuffer buffer;
-        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-        document_.Accept(writer);
+        detail::JsonWriter<rapidjson::StringBuffer> writer(buffer);
+        acceptDocument(writer);
         return buffer.GetString();
     }
     
+    // JSON 문자열 변환 (maxBytes 이내, 넘치는 부분은 잘림 표시 후 구조를 닫음, JsonableBudget.hpp 필요)
+    template<typename Writer = detail::BudgetWriter>
+    inline std::string documentToString(size_t maxBytes) const {
+        return Writer::write(maxBytes, [this](Writer& writer) {
+            acceptDocument(writer);
+        });
+    }
+    
+    // 임의의 출력 스트림(RapidJSON OutputStream 개념)으로 직접 변환
+    // iovec처럼 전용 Writer가 있는 출력은 Writer를 함께 지정
+    template<typename OutputStream, typename Writer = detail::JsonWriter<OutputStream>>
+    inline bool documentToStream(OutputStream& stream) const {
+        Writer writer(stream);
+        return acceptDocument(writer);
+    }
+    
+    // JSON 문자열 병렬 변환 (threadCount == 0 이면 하드웨어 스레드 수 사용, JsonableParallel.hpp 필요)
+    template<typename Serializer = detail::ParallelSerializer>
+    inline std::string documentToStringParallel(size_t threadCount) const {
+        if (threadCount == 1 || !Serializer::worthSplitting(document_, &packedArrays_)) {
+            return documentToString();
+        }
+        return Serializer(document_, threadCount, &packedArrays_, &decimals_).run();
+    }
+    
     // JSON 문자열 파싱
+    // 루트 멤버 숫자 배열은 요소별 Value 없이 packed 버퍼로 바로 변환됨
     inline void parseFromString(const std::string& jsonStr) {
-        document_.Parse(jsonStr.c_str());
+        finishParse(detail::parseWithPacking(document_, jsonStr.c_str(), packedArrays_, decimalSink()));
+    }
+    
+    // 바이트 범위 파싱 ('\0' 종료 불필요, 범위 밖은 읽지 않음)
+    inline void parseFromRange(const char* json, size_t length) {
+        finishParse(detail::parseRangeWithPacking(document_, json, length, packedArrays_, decimalSink()));
+    }
+    
+    // SAX 이벤트 생성기로 document 구성 (텍스트 파싱 없음)
+    template<typename Accept>
+    inline void populateFromEvents(Accept&& accept) {
+        finishParse(detail::populateWithPacking(document_, std::forward<Accept>(accept), packedArrays_, decimalSink()));
+    }
+    
+    // JSON 버퍼 제자리 파싱 (문자열 값이 buffer를 직접 참조, buffer는 '\0' 종료)
+    inline void parseFromBufferInsitu(char* json) {
+        finishParse(detail::parseInsituWithPacking(document_, json, packedArrays_, decimalSink()));
+    }
+    
+    // 파싱 경로가 10진수 원문을 수집할 곳 (보존 모드는 출력용 맵, 기본은 getDecimal 전용 맵)
+    inline detail::DecimalMap* decimalSink() {
+        return preserveDecimals_ ? &decimals_ : &parsedDecimals_;
+    }
+    
+    // 파싱 성공 시 이전 값 제거 (수집한 맵은 파싱 결과로 이미 교체됨)
+    inline void finishParse(bool ok) {
+        if (ok) {
+            if (preserveDecimals_) parsedDecimals_.clear();
+            else decimals_.clear();
+        }
         contextStack_.clear(); // 파싱 후 컨텍스트 초기화
     }
     
+    // document 비우기 (외부 버퍼 참조 해제)
+    inline void releaseDocument() {
+        document_.SetObject();
+        packedArrays_.clear();
+        decimals_.clear();
+        parsedDecimals_.clear();
+        contextStack_.clear();
+    }
+    
     // ========================================
     // 타입 변환 헬퍼들
     // ========================================
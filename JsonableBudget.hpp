@@ -0,0 +1,276 @@
+#pragma once
+
+/**
+ * JsonableBudget.hpp - 바이트 예산 제한 직렬화 (완전 inline)
+ *
+ * 역할: 출력이 maxBytes를 넘기 전에 쓰기를 멈추고
+ *       잘린 문자열/배열/객체를 표시한 뒤 열린 구조를 닫아 유효한 JSON 유지
+ *       (로그 한 줄 비용을 객체 크기와 무관하게 제한)
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <initializer_list>
+#include <utility>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/internal/dtoa.h>
+
+#include "JsonableNumber.hpp"
+#include "JsonableWriter.hpp"
+
+namespace json {
+namespace detail {
+
+// 잘림 표시: 문자열 끝 "abc...", 배열 마지막 요소 "...", 객체 마지막 멤버 "...":"..."
+constexpr char kTruncationMarker[] = "...";
+constexpr size_t kTruncationMarkerLength = sizeof(kTruncationMarker) - 1;
+
+/**
+ * @brief 문자열을 Writer가 이스케이프했을 때의 길이 계산 (limit까지만)
+ *
+ * @param taken 출력: limit 안에 들어가는 원본 바이트 수 (UTF-8 문자 경계)
+ * @return taken 바이트의 이스케이프 후 길이
+ */
+inline size_t escapedPrefix(const char* str, size_t length, size_t limit, size_t& taken) {
+    size_t escaped = 0;
+    size_t i = 0;
+    while (i < length) {
+        const unsigned char c = static_cast<unsigned char>(str[i]);
+        size_t cost;
+        size_t width = 1;
+        if (c == '"' || c == '\\' || c == '\b' || c == '\f' || c == '\n' || c == '\r' || c == '\t') {
+            cost = 2;
+        } else if (c < 0x20) {
+            cost = 6;   // \u00XX
+        } else {
+            // 멀티바이트 문자는 통째로 (연속 바이트 수만큼)
+            width = c < 0x80 ? 1 : c >= 0xF0 ? 4 : c >= 0xE0 ? 3 : c >= 0xC0 ? 2 : 1;
+            if (i + width > length) width = length - i;
+            cost = width;
+        }
+        if (escaped + cost > limit) break;
+        escaped += cost;
+        i += width;
+    }
+    taken = i;
+    return escaped;
+}
+
+inline size_t escapedLength(const char* str, size_t length) {
+    size_t taken;
+    return escapedPrefix(str, length, SIZE_MAX, taken);
+}
+
+/**
+ * @brief 출력 바이트 예산을 지키는 SAX 핸들러
+ *
+ * - 값(키 포함)은 예산 안에 통째로 들어갈 때만 출력
+ * - 문자열 값은 들어가는 만큼 잘라 "..." 을 붙여 출력
+ * - 그 외 값이 넘치면 false를 반환해 순회 중단 → finish()가 열린 구조마다
+ *   표시를 넣고 닫음 (잘린 지점을 감싸는 모든 배열/객체에 표시)
+ * - 열린 구조의 닫는 괄호는 항상 예약, reserveMarkers면 표시 공간도 예약
+ *   (루트 구조 자체는 항상 출력: 최소 {"...":"..."} 13바이트)
+ *
+ * 표시를 예약하지 않은 출력은 잘림이 없거나 표시가 남은 공간에 들어갈 때만
+ * 예산을 지킴 → writeWithinBudget()이 필요할 때만 예약 모드로 다시 출력
+ */
+class BudgetWriter {
+public:
+    // writeWithinBudget과 같음 (JsonableBase가 이 헤더 없이 선언만으로 참조하는 진입점)
+    template<typename Accept>
+    static inline std::string write(size_t maxBytes, Accept&& accept);
+
+    BudgetWriter(rapidjson::StringBuffer& buffer, size_t maxBytes, bool reserveMarkers)
+        : buffer_(buffer), writer_(buffer), budget_(maxBytes), reserveMarkers_(reserveMarkers) {}
+
+    bool Null() { return scalar("null", 4, rapidjson::kNullType); }
+    bool Bool(bool b) { return b ? scalar("true", 4, rapidjson::kTrueType) : scalar("false", 5, rapidjson::kFalseType); }
+    bool Int(int i) { return Int64(i); }
+    bool Uint(unsigned u) { return Uint64(u); }
+
+    bool Int64(int64_t i) {
+        char text[kMaxIntegerTextLength];
+        return scalar(text, formatInt64(i, text), rapidjson::kNumberType);
+    }
+
+    bool Uint64(uint64_t u) {
+        char text[kMaxIntegerTextLength];
+        return scalar(text, formatUint64(u, text), rapidjson::kNumberType);
+    }
+
+    bool Double(double d) {
+        // 기본 Writer와 같은 dtoa로 스택 버퍼에 출력 (NaN/Inf는 Writer처럼 거부)
+        if (!std::isfinite(d)) return false;
+        char text[32];
+        const char* end = rapidjson::internal::dtoa(d, text, writer_.GetMaxDecimalPlaces());
+        return scalar(text, static_cast<size_t>(end - text), rapidjson::kNumberType);
+    }
+
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool) {
+        return scalar(str, length, rapidjson::kNumberType);
+    }
+
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        const size_t prefix = prefixCost();
+        const size_t full = escapedLength(str, length) + 2;
+        if (fits(prefix + full)) {
+            writeKey();
+            return writer_.String(str, length) && count();
+        }
+
+        // 들어가는 만큼만 "...": 표시 자리까지 남지 않으면 값 생략
+        const size_t overhead = prefix + 2 + kTruncationMarkerLength;
+        if (!fits(overhead)) return false;
+        size_t taken;
+        escapedPrefix(str, length, remaining() - overhead, taken);
+        std::string truncated(str, taken);
+        truncated += kTruncationMarker;
+        writeKey();
+        writer_.String(truncated.data(), static_cast<rapidjson::SizeType>(truncated.size()));
+        count();
+        return false;   // 이후 값은 모두 생략
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        // 값과 함께 들어갈 때만 출력하도록 보류
+        pendingKey_ = str;
+        pendingKeyLength_ = length;
+        return true;
+    }
+
+    bool StartObject() { return start(false); }
+    bool StartArray() { return start(true); }
+    bool EndObject(rapidjson::SizeType) { return end(); }
+    bool EndArray(rapidjson::SizeType) { return end(); }
+
+    /**
+     * @brief 순회가 중단되었으면 열린 구조를 표시 후 닫음
+     *
+     * @return 결과가 예산 이내인지
+     */
+    inline bool finish() {
+        while (!frames_.empty()) {
+            const Frame frame = frames_.back();
+            frames_.pop_back();
+            reserved_ -= frameReserve(frame.isArray);
+            if (!frame.isArray) writer_.Key(kTruncationMarker, static_cast<rapidjson::SizeType>(kTruncationMarkerLength));
+            writer_.String(kTruncationMarker, static_cast<rapidjson::SizeType>(kTruncationMarkerLength));
+            if (frame.isArray) {
+                writer_.EndArray();
+            } else {
+                writer_.EndObject();
+            }
+        }
+        if (buffer_.GetSize() == 0) writer_.Null();   // 루트 스칼라가 통째로 넘친 경우
+        return buffer_.GetSize() <= budget_;
+    }
+
+private:
+    struct Frame {
+        bool isArray;
+        size_t count;
+    };
+
+    // 닫는 괄호 + 표시 (",\"...\"" 또는 ",\"...\":\"...\"")
+    inline size_t frameReserve(bool isArray) const {
+        if (!reserveMarkers_) return 1;
+        return 1 + (isArray ? 1 + kTruncationMarkerLength + 2
+                            : 1 + 2 * (kTruncationMarkerLength + 2) + 1);
+    }
+
+    inline size_t remaining() const {
+        const size_t used = buffer_.GetSize() + reserved_;
+        return used < budget_ ? budget_ - used : 0;
+    }
+
+    inline bool fits(size_t cost) const { return cost <= remaining(); }
+
+    // 값 앞에 붙는 쉼표와 보류 중인 키 ("key":)
+    inline size_t prefixCost() const {
+        size_t cost = (!frames_.empty() && frames_.back().count > 0) ? 1 : 0;
+        if (pendingKey_) cost += escapedLength(pendingKey_, pendingKeyLength_) + 3;
+        return cost;
+    }
+
+    inline void writeKey() {
+        if (pendingKey_) {
+            writer_.Key(pendingKey_, static_cast<rapidjson::SizeType>(pendingKeyLength_));
+            pendingKey_ = nullptr;
+        }
+    }
+
+    inline bool count() {
+        if (!frames_.empty()) ++frames_.back().count;
+        return true;
+    }
+
+    inline bool scalar(const char* text, size_t length, rapidjson::Type type) {
+        if (!fits(prefixCost() + length)) return false;
+        writeKey();
+        return writer_.RawValue(text, length, type) && count();
+    }
+
+    inline bool start(bool isArray) {
+        const bool root = frames_.empty() && buffer_.GetSize() == 0;
+        if (!root && !fits(prefixCost() + 1 + frameReserve(isArray))) return false;
+        writeKey();
+        count();
+        if (isArray) {
+            writer_.StartArray();
+        } else {
+            writer_.StartObject();
+        }
+        frames_.push_back(Frame{isArray, 0});
+        reserved_ += frameReserve(isArray);
+        return true;
+    }
+
+    inline bool end() {
+        const Frame frame = frames_.back();
+        frames_.pop_back();
+        reserved_ -= frameReserve(frame.isArray);
+        return frame.isArray ? writer_.EndArray() : writer_.EndObject();
+    }
+
+    rapidjson::StringBuffer& buffer_;
+    JsonWriter<rapidjson::StringBuffer> writer_;
+    size_t budget_;
+    bool reserveMarkers_;
+    size_t reserved_ = 0;
+    std::vector<Frame> frames_;
+    const char* pendingKey_ = nullptr;
+    size_t pendingKeyLength_ = 0;
+};
+
+/**
+ * @brief Handler 순회(accept)를 예산 이내로 출력
+ *
+ * 1차: 닫는 괄호만 예약 (잘림이 없으면 전체 출력과 동일)
+ * 2차: 1차 결과가 표시 때문에 넘친 경우에만 표시 공간까지 예약하여 다시 출력
+ */
+template<typename Accept>
+inline std::string writeWithinBudget(size_t maxBytes, Accept&& accept) {
+    for (const bool reserveMarkers : {false, true}) {
+        rapidjson::StringBuffer buffer;
+        BudgetWriter writer(buffer, maxBytes, reserveMarkers);
+        accept(writer);
+        if (writer.finish() || reserveMarkers) {
+            return std::string(buffer.GetString(), buffer.GetSize());
+        }
+    }
+    return std::string();
+}
+
+template<typename Accept>
+inline std::string BudgetWriter::write(size_t maxBytes, Accept&& accept) {
+    return writeWithinBudget(maxBytes, std::forward<Accept>(accept));
+}
+
+} // namespace detail
+} // namespace json
@@ -0,0 +1,766 @@
+#pragma once
+
+/**
+ * JsonableBulkIo.hpp - 대량 파일 로드/저장 엔진 (완전 inline, POSIX 전용)
+ *
+ * 역할: 수천 개의 JSON 파일을 한 번에 읽어 객체로, 객체들을 파일로 저장
+ *       - io_uring 사용 가능 시: 호출 스레드가 읽기/쓰기를 queueDepth개까지 동시에 걸어 두고
+ *         완료된 버퍼는 파싱 워커로, 워커가 직렬화한 버퍼는 쓰기로 넘김 (디스크와 CPU 동시 사용)
+ *       - 사용 불가 시 (구버전 커널, seccomp, 비 Linux): 블로킹 I/O + 파싱을 work-stealing 풀로 처리
+ *
+ * io_uring은 liburing 없이 시스템 콜로 직접 설정 (추가 의존성 없음)
+ * 메모리 사용량은 동시 I/O 수 + 대기 버퍼 수(queueDepth * 2)로 제한됨
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define JSONABLE_HAS_BULK_IO 1
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define JSONABLE_HAS_IO_URING 1
+#endif
+#endif
+#endif
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(JSONABLE_HAS_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#endif
+
+#include "JsonableParallel.hpp"
+
+namespace json {
+namespace detail {
+
+// ========================================
+// 블로킹 파일 I/O
+// ========================================
+
+inline bool readWholeFile(const std::string& path, std::string& out) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    out.resize(static_cast<size_t>(info.st_size));
+    size_t done = 0;
+    while (done < out.size()) {
+        ssize_t n = ::pread(fd, &out[done], out.size() - done, static_cast<off_t>(done));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += static_cast<size_t>(n);
+    }
+    ::close(fd);
+    out.resize(done);
+    return true;
+}
+
+inline bool writeWholeFile(const std::string& path, const std::string& data) {
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) return false;
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = ::pwrite(fd, data.data() + done, data.size() - done, static_cast<off_t>(done));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) break;
+        done += static_cast<size_t>(n);
+    }
+    return ::close(fd) == 0 && done == data.size();
+}
+
+/**
+ * @brief 용량 제한 인덱스 큐 (I/O 스레드 ↔ 워커 사이 버퍼 전달)
+ */
+class BulkQueue {
+public:
+    explicit BulkQueue(size_t capacity) : capacity_(capacity == 0 ? 1 : capacity) {}
+
+    // 가득 차면 공간이 생길 때까지 대기, 닫혔으면 false
+    inline bool push(size_t value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this] { return items_.size() < capacity_ || closed_; });
+        if (closed_) return false;
+        items_.push_back(value);
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    // 비어 있으면 대기, 닫혔고 비었으면 false
+    inline bool pop(size_t& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this] { return !items_.empty() || closed_; });
+        if (items_.empty()) return false;
+        value = items_.front();
+        items_.pop_front();
+        notFull_.notify_one();
+        return true;
+    }
+
+    inline bool tryPop(size_t& value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (items_.empty()) return false;
+        value = items_.front();
+        items_.pop_front();
+        notFull_.notify_one();
+        return true;
+    }
+
+    inline void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        notEmpty_.notify_all();
+        notFull_.notify_all();
+    }
+
+private:
+    size_t capacity_;
+    std::deque<size_t> items_;
+    bool closed_ = false;
+    std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+};
+
+/**
+ * @brief io_uring 경로의 파싱/직렬화 스레드 묶음
+ *
+ * 작업 예외는 첫 번째만 보관하고 이후 작업은 건너뜀 (std::terminate 대신 join 후 호출 스레드에서 다시 던짐)
+ * 스레드가 큐에서 대기할 수 있으므로 join 전에 큐를 먼저 닫을 것
+ */
+class BulkWorkers {
+public:
+    BulkWorkers() = default;
+    ~BulkWorkers() { join(); }
+
+    BulkWorkers(const BulkWorkers&) = delete;
+    BulkWorkers& operator=(const BulkWorkers&) = delete;
+
+    template<typename Loop>
+    inline void start(size_t count, const Loop& loop) {
+        for (size_t i = 0; i < count; ++i) threads_.emplace_back(loop);
+    }
+
+    // 작업 하나 실행 (앞서 예외가 났으면 건너뜀), 끝까지 실행했으면 true
+    template<typename Task>
+    inline bool run(Task&& task) {
+        if (failed_.load(std::memory_order_relaxed)) return false;
+        try {
+            task();
+            return true;
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            if (!error_) error_ = std::current_exception();
+            failed_.store(true, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    inline void join() {
+        for (auto& thread : threads_) {
+            if (thread.joinable()) thread.join();
+        }
+        threads_.clear();
+    }
+
+    inline void rethrow() {
+        if (error_) std::rethrow_exception(error_);
+    }
+
+private:
+    std::vector<std::thread> threads_;
+    std::atomic<bool> failed_{false};
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+#if defined(JSONABLE_HAS_IO_URING)
+
+/**
+ * @brief 최소 io_uring 래퍼 (단일 스레드 제출/완료)
+ */
+class IoUring {
+public:
+    IoUring() = default;
+    ~IoUring() { reset(); }
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    inline bool init(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        long fd = ::syscall(__NR_io_uring_setup, entries, &params);
+        if (fd < 0) return false;
+        fd_ = static_cast<int>(fd);
+
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap) sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+
+        sqRing_ = map(sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = singleMap ? sqRing_ : map(cqRingSize_, IORING_OFF_CQ_RING);
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = map(sqesSize_, IORING_OFF_SQES);
+        if (!sqRing_ || !cqRing_ || !sqes) {
+            if (sqes) ::munmap(sqes, sqesSize_);
+            reset();
+            return false;
+        }
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(sqRing_);
+        sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sqEntries_ = params.sq_entries;
+
+        char* cq = static_cast<char*>(cqRing_);
+        cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    inline void reset() {
+        if (sqes_) ::munmap(sqes_, sqesSize_);
+        if (cqRing_ && cqRing_ != sqRing_) ::munmap(cqRing_, cqRingSize_);
+        if (sqRing_) ::munmap(sqRing_, sqRingSize_);
+        if (fd_ >= 0) ::close(fd_);
+        sqes_ = nullptr;
+        sqRing_ = cqRing_ = nullptr;
+        fd_ = -1;
+        unsubmitted_ = 0;
+    }
+
+    inline bool valid() const { return fd_ >= 0; }
+    inline unsigned entries() const { return sqEntries_; }
+
+    /**
+     * @brief 벡터 읽기/쓰기 항목 하나를 제출 큐에 추가 (가득 차면 false)
+     */
+    inline bool prepare(uint8_t opcode, int fd, const iovec* iov, uint64_t offset, uint64_t userData) {
+        io_uring_sqe* sqe = nextEntry();
+        if (!sqe) return false;
+        sqe->opcode = opcode;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(iov);
+        sqe->len = 1;
+        sqe->off = offset;
+        sqe->user_data = userData;
+        commitEntry();
+        return true;
+    }
+
+    /**
+     * @brief target(userData)으로 제출한 요청의 취소 항목 추가 (가득 차면 false)
+     */
+    inline bool prepareCancel(uint64_t target, uint64_t userData) {
+        io_uring_sqe* sqe = nextEntry();
+        if (!sqe) return false;
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = target;
+        sqe->user_data = userData;
+        commitEntry();
+        return true;
+    }
+
+    /**
+     * @brief 커널이 아직 가져가지 않은 항목을 제출 큐에서 되돌림 (각 항목의 userData를 추가)
+     *
+     * SQPOLL 없이 한 스레드만 제출하므로 io_uring_enter 밖에서는 커널이 큐를 읽지 않음
+     */
+    inline void retract(std::vector<uint64_t>& userData) {
+        const unsigned head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+        const unsigned tail = *sqTail_;
+        for (unsigned i = head; i != tail; ++i) userData.push_back(sqes_[sqArray_[i & sqMask_]].user_data);
+        __atomic_store_n(sqTail_, head, __ATOMIC_RELEASE);
+        unsubmitted_ = 0;
+    }
+
+    /**
+     * @brief 쌓인 항목 제출, waitCount > 0 이면 그만큼 완료될 때까지 대기
+     */
+    inline bool submit(unsigned waitCount) {
+        for (;;) {
+            long submitted = ::syscall(__NR_io_uring_enter, fd_, unsubmitted_, waitCount,
+                                       waitCount ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+            if (submitted >= 0) {
+                unsubmitted_ -= static_cast<unsigned>(submitted);
+                return true;
+            }
+            if (errno == EINTR) continue;
+            // 완료 큐를 먼저 비워야 하는 상황: 호출자가 완료를 거둔 뒤 다시 시도
+            return errno == EAGAIN || errno == EBUSY;
+        }
+    }
+
+    inline bool pop(uint64_t& userData, int32_t& result) {
+        const unsigned head = *cqHead_;
+        if (head == __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE)) return false;
+        const io_uring_cqe& cqe = cqes_[head & cqMask_];
+        userData = cqe.user_data;
+        result = cqe.res;
+        __atomic_store_n(cqHead_, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+private:
+    inline io_uring_sqe* nextEntry() {
+        const unsigned tail = *sqTail_;
+        if (tail - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE) >= sqEntries_) return nullptr;
+        io_uring_sqe* sqe = &sqes_[tail & sqMask_];
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    inline void commitEntry() {
+        const unsigned tail = *sqTail_;
+        sqArray_[tail & sqMask_] = tail & sqMask_;
+        __atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+        ++unsubmitted_;
+    }
+
+    inline void* map(size_t size, uint64_t offset) {
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_,
+                               static_cast<off_t>(offset));
+        return address == MAP_FAILED ? nullptr : address;
+    }
+
+    int fd_ = -1;
+    void* sqRing_ = nullptr;
+    void* cqRing_ = nullptr;
+    size_t sqRingSize_ = 0;
+    size_t cqRingSize_ = 0;
+    size_t sqesSize_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+
+    unsigned* sqHead_ = nullptr;
+    unsigned* sqTail_ = nullptr;
+    unsigned* sqArray_ = nullptr;
+    unsigned sqMask_ = 0;
+    unsigned sqEntries_ = 0;
+    unsigned unsubmitted_ = 0;
+
+    unsigned* cqHead_ = nullptr;
+    unsigned* cqTail_ = nullptr;
+    unsigned cqMask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+};
+
+#endif // JSONABLE_HAS_IO_URING
+
+} // namespace detail
+
+/**
+ * @brief 대량 로드/저장 결과
+ */
+struct BulkResult {
+    size_t succeeded = 0;
+    std::vector<size_t> failed;   // 열기/읽기/쓰기에 실패한 파일 인덱스 (오름차순)
+
+    inline bool ok() const { return failed.empty(); }
+};
+
+enum class BulkBackend {
+    Auto,       // io_uring 가능하면 사용
+    Blocking    // 항상 블로킹 I/O 워커 풀
+};
+
+/**
+ * @brief 대량 JSON 파일 로드/저장 엔진
+ *
+ * @code
+ * json::BulkIo io;                                   // 워커 = 코어 수, 동시 I/O 64개
+ * std::vector<Order> orders;
+ * auto result = io.loadAll(paths, orders);           // orders[i] ← paths[i]
+ * for (size_t index : result.failed) log(paths[index]);
+ *
+ * io.saveAll(outputPaths, orders);
+ * @endcode
+ *
+ * 한 BulkIo 인스턴스를 여러 스레드에서 동시에 사용하지 말 것 (ring은 인스턴스당 하나)
+ * 파싱 오류는 fromJson과 동일하게 처리됨 (실패 목록에는 I/O 오류와 빈 파일만 포함)
+ */
+class BulkIo {
+public:
+    /**
+     * @param workers 파싱/직렬화 스레드 수 (0 = 코어 수)
+     * @param queueDepth 동시에 걸어 둘 I/O 수
+     */
+    explicit BulkIo(size_t workers = 0, unsigned queueDepth = 64, BulkBackend backend = BulkBackend::Auto)
+        : workers_(workers ? workers : std::max<size_t>(1, std::thread::hardware_concurrency())),
+          queueDepth_(queueDepth ? queueDepth : 1), pool_(workers_) {
+#if defined(JSONABLE_HAS_IO_URING)
+        if (backend == BulkBackend::Auto && ring_.init(queueDepth_)) {
+            queueDepth_ = std::min(queueDepth_, ring_.entries());
+        }
+#else
+        (void)backend;
+#endif
+    }
+
+    inline bool usesIoUring() const {
+#if defined(JSONABLE_HAS_IO_URING)
+        return ring_.valid();
+#else
+        return false;
+#endif
+    }
+
+    // ========================================
+    // 로드
+    // ========================================
+
+    /**
+     * @brief paths[i] 파일을 out[i]로 역직렬화 (out은 paths 크기로 재설정)
+     */
+    template<typename T>
+    inline BulkResult loadAll(const std::vector<std::string>& paths, std::vector<T>& out) {
+        const size_t count = paths.size();
+        out.clear();
+        out.resize(count);
+        std::vector<uint8_t> status(count, 0);
+
+#if defined(JSONABLE_HAS_IO_URING)
+        if (ring_.valid()) {
+            std::vector<std::string> buffers(count);
+            detail::BulkQueue parsed(static_cast<size_t>(queueDepth_) * 2);
+            detail::BulkWorkers workers;
+            try {
+                workers.start(workers_, [&] {
+                    size_t index;
+                    while (parsed.pop(index)) {
+                        workers.run([&] {
+                            out[index].fromJson(buffers[index].data(), buffers[index].size());
+                            status[index] = 1;
+                        });
+                        std::string().swap(buffers[index]);
+                    }
+                });
+
+                size_t next = 0;
+                runRing(IORING_OP_READV,
+                    [&](size_t& index, bool) {
+                        if (next == count) return -1;
+                        index = next++;
+                        return 1;
+                    },
+                    [&](Transfer& transfer) {
+                        transfer.fd = ::open(paths[transfer.index].c_str(), O_RDONLY | O_CLOEXEC);
+                        if (transfer.fd < 0) return false;
+                        struct stat info;
+                        if (::fstat(transfer.fd, &info) != 0) {
+                            ::close(transfer.fd);
+                            return false;
+                        }
+                        std::string& buffer = buffers[transfer.index];
+                        buffer.resize(static_cast<size_t>(info.st_size));
+                        transfer.data = &buffer[0];
+                        transfer.size = buffer.size();
+                        return true;
+                    },
+                    [&](size_t index, bool ok, size_t bytes) {
+                        // 빈 파일은 유효한 JSON이 아님
+                        if (!ok || bytes == 0) {
+                            std::string().swap(buffers[index]);
+                            return;
+                        }
+                        buffers[index].resize(bytes);
+                        parsed.push(index);
+                    });
+            } catch (...) {
+                parsed.close();
+                workers.join();
+                throw;
+            }
+
+            parsed.close();
+            workers.join();
+            workers.rethrow();
+            return collect(status);
+        }
+#endif
+
+        pool_.run(count, [&](size_t index) {
+            std::string text;
+            if (!detail::readWholeFile(paths[index], text) || text.empty()) return;
+            out[index].fromJson(text.data(), text.size());
+            status[index] = 1;
+        });
+        return collect(status);
+    }
+
+    // ========================================
+    // 저장
+    // ========================================
+
+    /**
+     * @brief objects[i]를 paths[i] 파일로 직렬화 (기존 파일은 덮어씀)
+     *
+     * paths와 objects 크기가 다르면 짧은 쪽까지만 처리
+     */
+    template<typename T>
+    inline BulkResult saveAll(const std::vector<std::string>& paths, const std::vector<T>& objects) {
+        const size_t count = std::min(paths.size(), objects.size());
+        std::vector<uint8_t> status(count, 0);
+
+#if defined(JSONABLE_HAS_IO_URING)
+        if (ring_.valid()) {
+            std::vector<std::string> outputs(count);
+            std::vector<uint8_t> serialized(count, 0);
+            detail::BulkQueue ready(static_cast<size_t>(queueDepth_) * 2);
+            std::atomic<size_t> nextTask{0};
+            detail::BulkWorkers workers;
+            try {
+                // 직렬화에 실패(또는 앞선 예외로 건너뜀)한 인덱스도 넘겨서 I/O 루프가 끝까지 진행하게 함
+                workers.start(std::min(workers_, count), [&] {
+                    for (size_t index = nextTask++; index < count; index = nextTask++) {
+                        serialized[index] = workers.run([&] { outputs[index] = objects[index].toJson(); }) ? 1 : 0;
+                        if (!ready.push(index)) return;
+                    }
+                });
+
+                size_t handed = 0;
+                runRing(IORING_OP_WRITEV,
+                    [&](size_t& index, bool block) {
+                        if (handed == count) return -1;
+                        if (!(block ? ready.pop(index) : ready.tryPop(index))) return 0;
+                        ++handed;
+                        return 1;
+                    },
+                    [&](Transfer& transfer) {
+                        if (!serialized[transfer.index]) return false;
+                        transfer.fd = ::open(paths[transfer.index].c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+                        if (transfer.fd < 0) return false;
+                        std::string& output = outputs[transfer.index];
+                        transfer.data = &output[0];
+                        transfer.size = output.size();
+                        return true;
+                    },
+                    [&](size_t index, bool ok, size_t) {
+                        std::string().swap(outputs[index]);
+                        status[index] = ok ? 1 : 0;
+                    });
+            } catch (...) {
+                ready.close();
+                workers.join();
+                throw;
+            }
+
+            workers.join();
+            workers.rethrow();
+            return collect(status);
+        }
+#endif
+
+        pool_.run(count, [&](size_t index) {
+            status[index] = detail::writeWholeFile(paths[index], objects[index].toJson()) ? 1 : 0;
+        });
+        return collect(status);
+    }
+
+private:
+    static inline BulkResult collect(const std::vector<uint8_t>& status) {
+        BulkResult result;
+        for (size_t i = 0; i < status.size(); ++i) {
+            if (status[i]) ++result.succeeded;
+            else result.failed.push_back(i);
+        }
+        return result;
+    }
+
+#if defined(JSONABLE_HAS_IO_URING)
+    // 진행 중인 파일 하나 (짧은 읽기/쓰기는 남은 구간으로 다시 제출)
+    struct Transfer {
+        size_t index = 0;
+        int fd = -1;
+        char* data = nullptr;
+        size_t size = 0;
+        size_t done = 0;
+        iovec iov{};
+    };
+
+    /**
+     * @brief 공통 I/O 루프 (호출 스레드)
+     *
+     * @param next (index, block) → 1: 다음 파일, 0: 아직 없음 (block이면 반환하지 않음), -1: 끝
+     * @param open Transfer의 fd/data/size 설정, 실패 시 false
+     * @param finish (index, 성공 여부, 전송 바이트) 파일마다 정확히 한 번 호출
+     *
+     * ring 오류 시 남은 파일을 모두 실패 처리하고 이후 호출은 블로킹 경로 사용
+     * ring 오류나 콜백 예외로 빠져나갈 때는 커널에 넘긴 요청을 취소하고 완료를 모두 거둔 뒤 반환
+     * (호출자가 버퍼를 해제해도 커널이 더 이상 접근하지 않음)
+     */
+    template<typename Next, typename Open, typename Finish>
+    inline void runRing(uint8_t opcode, Next&& next, Open&& open, Finish&& finish) {
+        std::vector<Transfer> slots(queueDepth_);
+        std::vector<uint8_t> busy(slots.size(), 0);     // 파일을 맡은 슬롯
+        std::vector<uint8_t> queued(slots.size(), 0);   // 완료를 기다리는 요청이 있는 슬롯
+        std::vector<size_t> freeSlots;
+        for (size_t slot = slots.size(); slot-- > 0;) freeSlots.push_back(slot);
+        size_t inflight = 0;
+        bool exhausted = false;
+
+        auto enqueue = [&](size_t slot) {
+            Transfer& transfer = slots[slot];
+            transfer.iov.iov_base = transfer.data + transfer.done;
+            transfer.iov.iov_len = transfer.size - transfer.done;
+            while (!ring_.prepare(opcode, transfer.fd, &transfer.iov, transfer.done, slot)) {
+                if (!ring_.submit(0)) return false;
+            }
+            queued[slot] = 1;
+            return true;
+        };
+        auto complete = [&](size_t slot, bool ok) {
+            Transfer& transfer = slots[slot];
+            if (::close(transfer.fd) != 0 && opcode == IORING_OP_WRITEV) ok = false;
+            busy[slot] = 0;
+            finish(transfer.index, ok, transfer.done);
+            freeSlots.push_back(slot);
+            --inflight;
+        };
+        // 커널에 넘긴 요청 취소 → 모든 완료 수거
+        auto abandon = [&] {
+            if (!ring_.valid()) return;
+            std::vector<uint64_t> retracted;
+            ring_.retract(retracted);
+            for (uint64_t userData : retracted) {
+                if (userData < slots.size()) queued[static_cast<size_t>(userData)] = 0;
+            }
+            size_t waiting = 0;
+            for (size_t slot = 0; slot < slots.size(); ++slot) {
+                if (!queued[slot]) continue;
+                ++waiting;
+                while (!ring_.prepareCancel(slot, kCancelTag | slot)) {
+                    if (!ring_.submit(0)) break;
+                }
+            }
+            uint64_t userData;
+            int32_t result;
+            while (waiting > 0) {
+                // 제출이 계속 실패해도 이미 넘어간 요청은 스스로 완료되므로 완료 큐를 계속 확인
+                if (!ring_.submit(1)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                while (ring_.pop(userData, result)) {
+                    if (userData < slots.size() && queued[static_cast<size_t>(userData)]) {
+                        queued[static_cast<size_t>(userData)] = 0;
+                        --waiting;
+                    }
+                }
+            }
+        };
+        auto fail = [&] {
+            abandon();
+            ring_.reset();
+            for (size_t slot = 0; slot < slots.size(); ++slot) {
+                if (busy[slot]) complete(slot, false);
+            }
+            size_t index;
+            while (next(index, true) > 0) finish(index, false, 0);
+        };
+
+        try {
+            for (;;) {
+                while (!exhausted && !freeSlots.empty()) {
+                    Transfer transfer;
+                    int state = next(transfer.index, inflight == 0);
+                    if (state < 0) exhausted = true;
+                    if (state <= 0) break;
+                    if (!open(transfer)) {
+                        finish(transfer.index, false, 0);
+                        continue;
+                    }
+                    if (transfer.size == 0) {
+                        ::close(transfer.fd);
+                        finish(transfer.index, true, 0);
+                        continue;
+                    }
+                    size_t slot = freeSlots.back();
+                    freeSlots.pop_back();
+                    slots[slot] = transfer;
+                    busy[slot] = 1;
+                    ++inflight;
+                    if (!enqueue(slot)) return fail();
+                }
+                if (inflight == 0) {
+                    if (exhausted) return;
+                    continue;
+                }
+
+                if (!ring_.submit(1)) return fail();
+
+                uint64_t userData;
+                int32_t result;
+                while (ring_.pop(userData, result)) {
+                    if (userData >= slots.size()) continue;   // 취소 요청 완료
+                    const size_t slot = static_cast<size_t>(userData);
+                    Transfer& transfer = slots[slot];
+                    queued[slot] = 0;
+                    if (result == -EINTR || result == -EAGAIN) {
+                        if (!enqueue(slot)) return fail();
+                    } else if (result < 0) {
+                        complete(slot, false);
+                    } else if (result == 0) {
+                        // 읽기: 파일이 fstat 이후 줄어듦 (읽은 만큼만 사용), 쓰기: 진행 불가
+                        complete(slot, opcode == IORING_OP_READV);
+                    } else {
+                        transfer.done += static_cast<size_t>(result);
+                        if (transfer.done < transfer.size) {
+                            if (!enqueue(slot)) return fail();
+                        } else {
+                            complete(slot, true);
+                        }
+                    }
+                }
+            }
+        } catch (...) {
+            // 콜백 예외: 버퍼가 해제되기 전에 커널 쪽 요청부터 정리 (ring은 비워진 상태로 계속 사용)
+            abandon();
+            for (size_t slot = 0; slot < slots.size(); ++slot) {
+                if (busy[slot]) ::close(slots[slot].fd);
+            }
+            throw;
+        }
+    }
+
+    static constexpr uint64_t kCancelTag = uint64_t(1) << 63;   // 취소 요청 userData 표시
+
+    detail::IoUring ring_;
+#endif
+
+    size_t workers_;
+    unsigned queueDepth_;
+    detail::WorkStealingPool pool_;   // 블로킹 경로 워커 (호출 사이에 재사용)
+};
+
+} // namespace json
+
+#endif // __unix__ || __APPLE__
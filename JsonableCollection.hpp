@@ -0,0 +1,343 @@
+#pragma once
+
+/**
+ * JsonableCollection.hpp - 보조 색인을 가진 메모리 컬렉션 (완전 inline)
+ *
+ * 역할: Jsonable 객체를 보관하고 선언한 필드로 색인 유지
+ *       - 필드 값은 삽입(갱신) 시 한 번만 추출 (조회 시 getter 호출 없음)
+ *       - 해시 색인: 동등 조회 O(1)
+ *       - 정렬 색인: 범위 조회 O(log n + k), 정렬 순회
+ *       - 삭제/갱신 시 색인 항목을 반복자로 바로 제거 (O(1)/O(log n))
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <functional>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+
+namespace json {
+
+/**
+ * @brief 컬렉션 안의 객체 식별자 (삭제 후 재사용될 수 있음)
+ */
+using CollectionHandle = size_t;
+
+namespace detail {
+
+template<typename T>
+class CollectionIndexBase {
+public:
+    virtual ~CollectionIndexBase() = default;
+    virtual void insert(CollectionHandle handle, const T& object) = 0;
+    virtual void erase(CollectionHandle handle) = 0;
+    virtual void clear() = 0;
+};
+
+/**
+ * @brief 색인 공통부: 핸들별 항목 반복자를 기억해 삭제를 탐색 없이 처리
+ *
+ * Container는 std::unordered_multimap 또는 std::multimap (둘 다 삽입/삭제 시
+ * 다른 항목의 반복자가 유효하게 유지됨)
+ */
+template<typename T, typename Key, typename Container>
+class CollectionIndex : public CollectionIndexBase<T> {
+public:
+    using Extractor = std::function<Key(const T&)>;
+
+    explicit CollectionIndex(Extractor extractor) : extractor_(std::move(extractor)) {}
+
+    void insert(CollectionHandle handle, const T& object) override {
+        if (positions_.size() <= handle) {
+            positions_.resize(handle + 1);
+            present_.resize(handle + 1, false);
+        }
+        positions_[handle] = entries_.emplace(extractor_(object), handle);
+        present_[handle] = true;
+    }
+
+    void erase(CollectionHandle handle) override {
+        if (handle < present_.size() && present_[handle]) {
+            entries_.erase(positions_[handle]);
+            present_[handle] = false;
+        }
+    }
+
+    void clear() override {
+        entries_.clear();
+        positions_.clear();
+        present_.clear();
+    }
+
+    const Container& entries() const { return entries_; }
+
+private:
+    Extractor extractor_;
+    Container entries_;
+    std::vector<typename Container::iterator> positions_;
+    std::vector<bool> present_;
+};
+
+} // namespace detail
+
+/**
+ * @brief 필드 색인을 가진 Jsonable 컬렉션
+ *
+ * @code
+ * json::Collection<User> users;
+ * users.addHashIndex<std::string>("email", [](const User& u) { return u.email; });
+ * users.addOrderedIndex<int64_t>("age", [](const User& u) { return u.getInt64("age"); });
+ *
+ * users.insert(std::move(user));
+ * users.insertJson(R"({"email":"a@b.c","age":31})");
+ *
+ * const User* found = users.findFirst<std::string>("email", "a@b.c");
+ * for (const User* u : users.findRange<int64_t>("age", 20, 29)) { ... }
+ * users.forEachOrdered<int64_t>("age", [](const User& u) { ... });
+ * @endcode
+ *
+ * 색인 이름/키 타입이 선언과 다르면 조회는 빈 결과를 반환
+ * 객체를 수정할 때는 update()를 사용해야 색인이 갱신됨
+ */
+template<typename T>
+class Collection {
+public:
+    using Handle = CollectionHandle;
+
+    Collection() = default;
+    Collection(const Collection&) = delete;
+    Collection& operator=(const Collection&) = delete;
+    Collection(Collection&&) = default;
+    Collection& operator=(Collection&&) = default;
+
+    // ========================================
+    // 색인 선언
+    // ========================================
+
+    /**
+     * @brief 동등 조회용 해시 색인 추가 (기존 객체도 즉시 색인)
+     *
+     * @return 같은 이름의 색인이 이미 있으면 false
+     */
+    template<typename Key, typename Extractor>
+    inline bool addHashIndex(const std::string& name, Extractor&& extractor) {
+        return addIndex(name, std::make_unique<HashIndex<Key>>(std::forward<Extractor>(extractor)));
+    }
+
+    /**
+     * @brief 범위 조회/정렬 순회용 정렬 색인 추가 (기존 객체도 즉시 색인)
+     */
+    template<typename Key, typename Extractor>
+    inline bool addOrderedIndex(const std::string& name, Extractor&& extractor) {
+        return addIndex(name, std::make_unique<OrderedIndex<Key>>(std::forward<Extractor>(extractor)));
+    }
+
+    // ========================================
+    // 객체 관리
+    // ========================================
+
+    inline Handle insert(T object) {
+        Handle handle;
+        if (!freeHandles_.empty()) {
+            handle = freeHandles_.back();
+            freeHandles_.pop_back();
+            slots_[handle] = std::make_unique<T>(std::move(object));
+        } else {
+            handle = slots_.size();
+            slots_.push_back(std::make_unique<T>(std::move(object)));
+        }
+        ++size_;
+        for (auto& index : indexes_) index.second->insert(handle, *slots_[handle]);
+        return handle;
+    }
+
+    /**
+     * @brief JSON 문자열로 객체를 만들어 삽입 (T::fromJson 사용)
+     */
+    inline Handle insertJson(const std::string& jsonStr) {
+        T object;
+        object.fromJson(jsonStr);
+        return insert(std::move(object));
+    }
+
+    inline bool erase(Handle handle) {
+        if (!contains(handle)) return false;
+        for (auto& index : indexes_) index.second->erase(handle);
+        slots_[handle].reset();
+        freeHandles_.push_back(handle);
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief 객체 수정 후 색인 재계산
+     *
+     * @code
+     * users.update(handle, [](User& u) { u.setInt64("age", 32); });
+     * @endcode
+     */
+    template<typename Mutator>
+    inline bool update(Handle handle, Mutator&& mutator) {
+        if (!contains(handle)) return false;
+        for (auto& index : indexes_) index.second->erase(handle);
+        mutator(*slots_[handle]);
+        for (auto& index : indexes_) index.second->insert(handle, *slots_[handle]);
+        return true;
+    }
+
+    inline void clear() {
+        slots_.clear();
+        freeHandles_.clear();
+        size_ = 0;
+        for (auto& index : indexes_) index.second->clear();
+    }
+
+    inline const T* get(Handle handle) const {
+        return contains(handle) ? slots_[handle].get() : nullptr;
+    }
+
+    inline bool contains(Handle handle) const {
+        return handle < slots_.size() && slots_[handle] != nullptr;
+    }
+
+    inline size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+
+    // 삽입 순서와 무관한 전체 순회
+    template<typename Visitor>
+    inline void forEach(Visitor&& visitor) const {
+        for (const auto& slot : slots_) {
+            if (slot) visitor(*slot);
+        }
+    }
+
+    // ========================================
+    // 조회
+    // ========================================
+
+    /**
+     * @brief 키가 같은 객체의 핸들 (해시/정렬 색인 모두 가능)
+     */
+    template<typename Key>
+    inline std::vector<Handle> findHandles(const std::string& name, const Key& key) const {
+        std::vector<Handle> result;
+        if (const auto* index = findIndex<HashIndex<Key>>(name)) {
+            const auto range = index->entries().equal_range(key);
+            for (auto it = range.first; it != range.second; ++it) result.push_back(it->second);
+        } else if (const auto* ordered = findIndex<OrderedIndex<Key>>(name)) {
+            const auto range = ordered->entries().equal_range(key);
+            for (auto it = range.first; it != range.second; ++it) result.push_back(it->second);
+        }
+        return result;
+    }
+
+    template<typename Key>
+    inline std::vector<const T*> findEqual(const std::string& name, const Key& key) const {
+        return toObjects(findHandles<Key>(name, key));
+    }
+
+    template<typename Key>
+    inline const T* findFirst(const std::string& name, const Key& key) const {
+        if (const auto* index = findIndex<HashIndex<Key>>(name)) {
+            const auto it = index->entries().find(key);
+            return it != index->entries().end() ? slots_[it->second].get() : nullptr;
+        }
+        if (const auto* ordered = findIndex<OrderedIndex<Key>>(name)) {
+            const auto it = ordered->entries().find(key);
+            return it != ordered->entries().end() ? slots_[it->second].get() : nullptr;
+        }
+        return nullptr;
+    }
+
+    template<typename Key>
+    inline size_t count(const std::string& name, const Key& key) const {
+        if (const auto* index = findIndex<HashIndex<Key>>(name)) return index->entries().count(key);
+        if (const auto* ordered = findIndex<OrderedIndex<Key>>(name)) return ordered->entries().count(key);
+        return 0;
+    }
+
+    /**
+     * @brief lower <= key <= upper 인 객체를 키 순서로 (정렬 색인 전용)
+     */
+    template<typename Key>
+    inline std::vector<const T*> findRange(const std::string& name, const Key& lower, const Key& upper) const {
+        std::vector<const T*> result;
+        if (const auto* index = findIndex<OrderedIndex<Key>>(name)) {
+            const auto end = index->entries().upper_bound(upper);
+            for (auto it = index->entries().lower_bound(lower); it != end; ++it) {
+                result.push_back(slots_[it->second].get());
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief 키 순서로 순회 (정렬 색인 전용, visitor가 false를 반환하면 중단)
+     */
+    template<typename Key, typename Visitor>
+    inline void forEachOrdered(const std::string& name, Visitor&& visitor, bool descending = false) const {
+        const auto* index = findIndex<OrderedIndex<Key>>(name);
+        if (!index) return;
+        const auto& entries = index->entries();
+        if (descending) {
+            for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+                if (!visit(visitor, *slots_[it->second])) return;
+            }
+        } else {
+            for (const auto& entry : entries) {
+                if (!visit(visitor, *slots_[entry.second])) return;
+            }
+        }
+    }
+
+private:
+    template<typename Key>
+    using HashIndex = detail::CollectionIndex<T, Key, std::unordered_multimap<Key, Handle>>;
+    template<typename Key>
+    using OrderedIndex = detail::CollectionIndex<T, Key, std::multimap<Key, Handle>>;
+
+    inline bool addIndex(const std::string& name, std::unique_ptr<detail::CollectionIndexBase<T>> index) {
+        if (indexes_.count(name)) return false;
+        for (Handle handle = 0; handle < slots_.size(); ++handle) {
+            if (slots_[handle]) index->insert(handle, *slots_[handle]);
+        }
+        indexes_.emplace(name, std::move(index));
+        return true;
+    }
+
+    template<typename Index>
+    inline const Index* findIndex(const std::string& name) const {
+        const auto it = indexes_.find(name);
+        return it != indexes_.end() ? dynamic_cast<const Index*>(it->second.get()) : nullptr;
+    }
+
+    inline std::vector<const T*> toObjects(const std::vector<Handle>& handles) const {
+        std::vector<const T*> result;
+        result.reserve(handles.size());
+        for (Handle handle : handles) result.push_back(slots_[handle].get());
+        return result;
+    }
+
+    // void 반환 visitor도 허용
+    template<typename Visitor>
+    static inline bool visit(Visitor& visitor, const T& object) {
+        if constexpr (std::is_same_v<decltype(visitor(object)), void>) {
+            visitor(object);
+            return true;
+        } else {
+            return static_cast<bool>(visitor(object));
+        }
+    }
+
+    std::vector<std::unique_ptr<T>> slots_;
+    std::vector<Handle> freeHandles_;
+    size_t size_ = 0;
+    std::unordered_map<std::string, std::unique_ptr<detail::CollectionIndexBase<T>>> indexes_;
+};
+
+} // namespace json
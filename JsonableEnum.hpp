@@ -0,0 +1,293 @@
+#pragma once
+
+/**
+ * JsonableEnum.hpp - 컴파일 타임 enum ↔ 문자열 테이블 (완전 inline)
+ *
+ * 역할: EnumTraits에 선언한 (값, 이름) 목록으로부터
+ *       - 디코드: 완전 해시(perfect hash) 테이블 → 문자열 비교 1회
+ *       - 인코드: 값 → 이름 직접 인덱스 테이블 (이름은 정적 리터럴 참조)
+ *       을 컴파일 타임에 생성
+ */
+
+#include <string_view>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace json {
+
+/**
+ * @brief enum 값과 JSON 이름 한 쌍
+ */
+template<typename E>
+struct EnumEntry {
+    E value;
+    std::string_view name;
+};
+
+/**
+ * @brief enum 이름 목록 (사용자가 특수화)
+ *
+ * @code
+ * enum class Status { Active, Paused, Closed };
+ *
+ * template<>
+ * struct json::EnumTraits<Status> {
+ *     static constexpr json::EnumEntry<Status> entries[] = {
+ *         {Status::Active, "active"},
+ *         {Status::Paused, "paused"},
+ *         {Status::Closed, "closed"},
+ *     };
+ * };
+ *
+ * setEnum("status", Status::Paused);            // "status":"paused"
+ * auto s = getEnum("status", Status::Active);   // 없거나 모르는 이름이면 기본값
+ * @endcode
+ *
+ * 이름은 이스케이프가 필요 없는 문자열이어야 함 (따옴표/역슬래시/제어 문자 금지)
+ */
+template<typename E>
+struct EnumTraits;
+
+template<typename E, typename = void>
+struct has_enum_traits : std::false_type {};
+
+template<typename E>
+struct has_enum_traits<E, std::void_t<decltype(EnumTraits<E>::entries)>> : std::true_type {};
+
+template<typename E>
+constexpr bool has_enum_traits_v = has_enum_traits<E>::value;
+
+namespace detail {
+
+// ========================================
+// 해시 (컴파일 타임/런타임 공용)
+// ========================================
+
+// FNV-1a: 이름 전체를 한 번만 훑음
+constexpr uint32_t enumNameHash(const char* str, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(str[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// 해시 + seed 재혼합 (murmur3 finalizer): seed만 바꿔 독립적인 해시 계열을 얻음
+constexpr uint32_t enumMix(uint32_t hash, uint32_t seed) {
+    hash ^= seed * 0x9E3779B9u;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+constexpr size_t enumPow2Ceil(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+constexpr bool enumNameNeedsEscape(std::string_view name) {
+    for (char c : name) {
+        if (c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief EnumTraits<E>로부터 생성되는 조회 테이블
+ *
+ * 디코드 (hash-and-displace 완전 해시):
+ * - 1단계: mix(h, 0)으로 버킷 선택
+ * - 2단계: 버킷별 displacement d로 mix(h, d) → 슬롯, 모든 이름이 서로 다른 슬롯
+ * - 슬롯의 후보 이름과 1회 비교로 확정 (모르는 이름 거부)
+ */
+template<typename E>
+class EnumTable {
+    static_assert(std::is_enum_v<E>, "EnumTable requires an enum type");
+    static_assert(has_enum_traits_v<E>, "Specialize json::EnumTraits<E> with an entries[] table");
+
+    static constexpr auto& kEntries = EnumTraits<E>::entries;
+
+public:
+    static constexpr size_t kCount = std::size(kEntries);
+    static constexpr size_t kBuckets = enumPow2Ceil(kCount);
+    static constexpr size_t kSlots = kBuckets * 2;   // 적재율 ≤ 0.5
+
+private:
+    // 버킷당 displacement 탐색 한도
+    static constexpr uint32_t kMaxDisplacement = 1u << 16;
+
+    using Underlying = std::underlying_type_t<E>;
+
+    struct Layout {
+        std::array<uint32_t, kBuckets> displacement{};
+        std::array<uint16_t, kSlots> slots{};   // 이름 인덱스 + 1 (0 = 빈 슬롯)
+        bool complete = false;
+    };
+
+    static constexpr Layout buildLayout() {
+        Layout layout;
+        std::array<uint32_t, kCount> hashes{};
+        std::array<size_t, kCount> bucketOf{};
+        std::array<size_t, kBuckets> bucketSize{};
+        size_t largest = 0;
+
+        for (size_t i = 0; i < kCount; ++i) {
+            hashes[i] = enumNameHash(kEntries[i].name.data(), kEntries[i].name.size());
+            bucketOf[i] = enumMix(hashes[i], 0) & (kBuckets - 1);
+            if (++bucketSize[bucketOf[i]] > largest) largest = bucketSize[bucketOf[i]];
+        }
+
+        // 큰 버킷부터 배치 (빈 슬롯이 많을 때 어려운 버킷을 처리)
+        for (size_t size = largest; size > 0; --size) {
+            for (size_t bucket = 0; bucket < kBuckets; ++bucket) {
+                if (bucketSize[bucket] != size) continue;
+
+                bool placed = false;
+                for (uint32_t d = 1; d < kMaxDisplacement && !placed; ++d) {
+                    std::array<uint16_t, kSlots> trial = layout.slots;
+                    bool fits = true;
+                    for (size_t i = 0; i < kCount && fits; ++i) {
+                        if (bucketOf[i] != bucket) continue;
+                        const size_t slot = enumMix(hashes[i], d) & (kSlots - 1);
+                        if (trial[slot] != 0) {
+                            fits = false;
+                        } else {
+                            trial[slot] = static_cast<uint16_t>(i + 1);
+                        }
+                    }
+                    if (fits) {
+                        layout.slots = trial;
+                        layout.displacement[bucket] = d;
+                        placed = true;
+                    }
+                }
+                if (!placed) return layout;   // 중복 이름 등
+            }
+        }
+        layout.complete = true;
+        return layout;
+    }
+
+    static constexpr Layout kLayout = buildLayout();
+
+    // ========================================
+    // 인코드: 값 → 이름 인덱스
+    // ========================================
+
+    static constexpr int64_t minValue() {
+        int64_t result = 0;
+        for (size_t i = 0; i < kCount; ++i) {
+            const int64_t v = static_cast<int64_t>(static_cast<Underlying>(kEntries[i].value));
+            if (i == 0 || v < result) result = v;
+        }
+        return result;
+    }
+
+    static constexpr int64_t maxValue() {
+        int64_t result = 0;
+        for (size_t i = 0; i < kCount; ++i) {
+            const int64_t v = static_cast<int64_t>(static_cast<Underlying>(kEntries[i].value));
+            if (i == 0 || v > result) result = v;
+        }
+        return result;
+    }
+
+    static constexpr int64_t kMinValue = minValue();
+    static constexpr uint64_t kValueRange = static_cast<uint64_t>(maxValue() - kMinValue) + 1;
+
+    // 값 범위가 촘촘하면 직접 인덱스, 아니면 선형 탐색
+    static constexpr bool kDense = kValueRange <= kCount * 4 + 16;
+    static constexpr size_t kDenseSize = kDense ? static_cast<size_t>(kValueRange) : 1;
+
+    static constexpr std::array<uint16_t, kDenseSize> buildDense() {
+        std::array<uint16_t, kDenseSize> table{};
+        if constexpr (kDense) {
+            for (size_t i = kCount; i-- > 0;) {   // 같은 값이 여럿이면 첫 항목 우선
+                const int64_t v = static_cast<int64_t>(static_cast<Underlying>(kEntries[i].value));
+                table[static_cast<size_t>(v - kMinValue)] = static_cast<uint16_t>(i + 1);
+            }
+        }
+        return table;
+    }
+
+    static constexpr std::array<uint16_t, kDenseSize> kDenseIndex = buildDense();
+
+    static constexpr bool validNames() {
+        for (size_t i = 0; i < kCount; ++i) {
+            if (kEntries[i].name.empty() || enumNameNeedsEscape(kEntries[i].name)) return false;
+        }
+        return true;
+    }
+
+    static_assert(kCount > 0 && kCount < 65535, "EnumTraits entries must have 1..65534 names");
+    static_assert(validNames(), "Enum names must be non-empty and need no JSON escaping");
+    static_assert(kLayout.complete, "Enum names must be unique (perfect hash construction failed)");
+
+public:
+    /**
+     * @brief 이름 → 값 (모르는 이름이면 false)
+     */
+    static inline bool decode(const char* str, size_t length, E& out) {
+        const uint32_t hash = enumNameHash(str, length);
+        const uint32_t d = kLayout.displacement[enumMix(hash, 0) & (kBuckets - 1)];
+        const uint16_t index = kLayout.slots[enumMix(hash, d) & (kSlots - 1)];
+        if (index == 0) return false;
+
+        const auto& entry = kEntries[index - 1];
+        if (entry.name.size() != length || entry.name.compare(0, length, str, length) != 0) return false;
+        out = entry.value;
+        return true;
+    }
+
+    /**
+     * @brief 값 → 이름 (목록에 없는 값이면 빈 string_view)
+     *
+     * 반환값은 EnumTraits 리터럴을 가리키므로 복사 없이 참조 가능
+     */
+    static inline std::string_view encode(E value) {
+        const int64_t v = static_cast<int64_t>(static_cast<Underlying>(value));
+        if constexpr (kDense) {
+            const uint64_t offset = static_cast<uint64_t>(v - kMinValue);
+            if (v < kMinValue || offset >= kValueRange) return {};
+            const uint16_t index = kDenseIndex[static_cast<size_t>(offset)];
+            return index ? kEntries[index - 1].name : std::string_view();
+        } else {
+            for (size_t i = 0; i < kCount; ++i) {
+                if (kEntries[i].value == value) return kEntries[i].name;
+            }
+            return {};
+        }
+    }
+};
+
+} // namespace detail
+
+// ========================================
+// 공개 헬퍼
+// ========================================
+
+/**
+ * @brief enum 값의 JSON 이름 (없으면 빈 문자열)
+ */
+template<typename E>
+inline std::string_view enumName(E value) {
+    return detail::EnumTable<E>::encode(value);
+}
+
+/**
+ * @brief JSON 이름 → enum 값 (모르는 이름이면 false, out 유지)
+ */
+template<typename E>
+inline bool parseEnum(std::string_view name, E& out) {
+    return detail::EnumTable<E>::decode(name.data(), name.size(), out);
+}
+
+} // namespace json
@@ -0,0 +1,632 @@
+#pragma once
+
+/**
+ * JsonableFrozen.hpp - 읽기 전용 위치 독립 document 이미지 (완전 inline, POSIX 전용)
+ *
+ * 역할: 큰 설정 JSON을 한 번만 파싱해 포인터 없는(오프셋 기반) 이미지로 고정하고
+ *       memfd/파일로 공개 → 여러 프로세스가 읽기 전용 mmap으로 공유하며 getter 실행
+ *       (프로세스별 파싱 시간과 사본 메모리 제거, 페이지는 커널 페이지 캐시에서 공유)
+ *
+ * 이미지 형식 (호스트 바이트 순서, 같은 호스트 공유용):
+ * - FrozenHeader: magic, version, 전체 크기, 루트 노드 오프셋
+ * - FrozenNode (16바이트): 타입 + 길이/개수 + 값 또는 오프셋
+ * - 배열: 연속 FrozenNode, 객체: 원래 순서의 FrozenMember + 키 정렬 인덱스
+ * - 문자열: '\0' 종료 바이트열
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define JSONABLE_HAS_FROZEN 1
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/document.h>
+
+#include "JsonableBase.hpp"
+
+namespace json {
+namespace detail {
+
+constexpr uint32_t kFrozenMagic = 0x4A53465A;   // "JSFZ"
+constexpr uint32_t kFrozenVersion = 1;
+constexpr size_t kFrozenMaxDepth = 512;
+
+enum class FrozenType : uint8_t { Null, False, True, Int, Uint, Double, String, Array, Object };
+
+struct FrozenHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t totalSize;
+    uint64_t rootOffset;
+    uint64_t reserved;
+};
+
+/**
+ * @brief 값 노드
+ *
+ * payload: Int/Uint/Double는 값 비트, String/Array/Object는 이미지 내 오프셋
+ * length: 문자열 바이트 수 / 배열 요소 수 / 객체 멤버 수
+ */
+struct FrozenNode {
+    FrozenType type;
+    uint8_t padding[3];
+    uint32_t length;
+    uint64_t payload;
+};
+
+struct FrozenMember {
+    uint64_t keyOffset;
+    uint32_t keyLength;
+    uint32_t padding;
+    FrozenNode value;
+};
+
+static_assert(sizeof(FrozenNode) == 16, "FrozenNode layout must be 16 bytes");
+static_assert(sizeof(FrozenMember) == 32, "FrozenMember layout must be 32 bytes");
+
+// ========================================
+// 이미지 생성
+// ========================================
+
+class FrozenBuilder {
+public:
+    inline std::string build(const rapidjson::Value& root) {
+        image_.assign(sizeof(FrozenHeader), '\0');
+        const uint64_t rootOffset = allocate(sizeof(FrozenNode));
+        fill(rootOffset, root);
+
+        FrozenHeader header{};
+        header.magic = kFrozenMagic;
+        header.version = kFrozenVersion;
+        header.totalSize = image_.size();
+        header.rootOffset = rootOffset;
+        std::memcpy(&image_[0], &header, sizeof(header));
+        return std::move(image_);
+    }
+
+private:
+    // 8바이트 정렬 영역 확보 후 오프셋 반환 (image_ 재할당 가능 → 포인터 대신 오프셋 사용)
+    inline uint64_t allocate(size_t size) {
+        const size_t offset = (image_.size() + 7) & ~size_t(7);
+        image_.resize(offset + size, '\0');
+        return offset;
+    }
+
+    inline uint64_t appendString(const char* str, size_t length) {
+        const uint64_t offset = allocate(length + 1);
+        std::memcpy(&image_[offset], str, length);
+        return offset;
+    }
+
+    inline void fill(uint64_t nodeOffset, const rapidjson::Value& value) {
+        FrozenNode node{};
+        if (value.IsNull()) {
+            node.type = FrozenType::Null;
+        } else if (value.IsBool()) {
+            node.type = value.GetBool() ? FrozenType::True : FrozenType::False;
+        } else if (value.IsUint64()) {
+            node.type = FrozenType::Uint;
+            node.payload = value.GetUint64();
+        } else if (value.IsInt64()) {
+            node.type = FrozenType::Int;
+            node.payload = static_cast<uint64_t>(value.GetInt64());
+        } else if (value.IsNumber()) {
+            node.type = FrozenType::Double;
+            const double d = value.GetDouble();
+            std::memcpy(&node.payload, &d, sizeof(d));
+        } else if (value.IsString()) {
+            node.type = FrozenType::String;
+            node.length = value.GetStringLength();
+            node.payload = appendString(value.GetString(), value.GetStringLength());
+        } else if (value.IsArray()) {
+            node.type = FrozenType::Array;
+            node.length = value.Size();
+            node.payload = allocate(sizeof(FrozenNode) * node.length);
+            uint64_t child = node.payload;
+            for (auto it = value.Begin(); it != value.End(); ++it, child += sizeof(FrozenNode)) {
+                fill(child, *it);
+            }
+        } else {
+            fillObject(node, value);
+        }
+        std::memcpy(&image_[nodeOffset], &node, sizeof(node));
+    }
+
+    inline void fillObject(FrozenNode& node, const rapidjson::Value& value) {
+        node.type = FrozenType::Object;
+        node.length = value.MemberCount();
+        node.payload = allocate(sizeof(FrozenMember) * node.length + sizeof(uint32_t) * node.length);
+        const uint64_t indexOffset = node.payload + sizeof(FrozenMember) * node.length;
+
+        std::vector<std::pair<std::string_view, uint32_t>> sorted;
+        sorted.reserve(node.length);
+        uint64_t memberOffset = node.payload;
+        uint32_t index = 0;
+        for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it, ++index, memberOffset += sizeof(FrozenMember)) {
+            FrozenMember member{};
+            member.keyLength = it->name.GetStringLength();
+            member.keyOffset = appendString(it->name.GetString(), member.keyLength);
+            std::memcpy(&image_[memberOffset], &member, sizeof(member));
+            fill(memberOffset + offsetof(FrozenMember, value), it->value);
+            sorted.emplace_back(std::string_view(it->name.GetString(), member.keyLength), index);
+        }
+
+        // 키 정렬 인덱스 (같은 키는 앞선 멤버 우선 → HasMember/operator[]와 동일)
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        for (uint32_t i = 0; i < node.length; ++i) {
+            std::memcpy(&image_[indexOffset + sizeof(uint32_t) * i], &sorted[i].second, sizeof(uint32_t));
+        }
+    }
+
+    std::string image_;
+};
+
+} // namespace detail
+
+// ========================================
+// 읽기: 값 뷰
+// ========================================
+
+/**
+ * @brief 고정 이미지 안의 값 하나 (포인터 2개, 복사 비용 없음)
+ *
+ * 없는 키/범위 밖 인덱스는 isValid() == false 인 값 (모든 as*()는 기본값)
+ */
+class FrozenValue {
+public:
+    FrozenValue() = default;
+    FrozenValue(const char* base, const detail::FrozenNode* node) : base_(base), node_(node) {}
+
+    inline bool isValid() const { return node_ != nullptr; }
+    inline bool isNull() const { return is(detail::FrozenType::Null); }
+    inline bool isBool() const { return is(detail::FrozenType::True) || is(detail::FrozenType::False); }
+    inline bool isNumber() const { return is(detail::FrozenType::Int) || is(detail::FrozenType::Uint) || is(detail::FrozenType::Double); }
+    inline bool isString() const { return is(detail::FrozenType::String); }
+    inline bool isArray() const { return is(detail::FrozenType::Array); }
+    inline bool isObject() const { return is(detail::FrozenType::Object); }
+
+    // 배열 요소 수 / 객체 멤버 수 (그 외 0)
+    inline size_t size() const { return (isArray() || isObject()) ? node_->length : 0; }
+
+    inline bool asBool(bool defaultValue = false) const {
+        return isBool() ? is(detail::FrozenType::True) : defaultValue;
+    }
+
+    inline int64_t asInt64(int64_t defaultValue = 0) const {
+        if (!isNumber()) return defaultValue;
+        if (is(detail::FrozenType::Double)) return static_cast<int64_t>(doubleBits());
+        return static_cast<int64_t>(node_->payload);
+    }
+
+    inline uint64_t asUInt64(uint64_t defaultValue = 0) const {
+        // 0 이상 정수는 모두 Uint로 저장됨 (Int는 음수)
+        return is(detail::FrozenType::Uint) ? node_->payload : defaultValue;
+    }
+
+    inline uint32_t asUInt32(uint32_t defaultValue = 0) const {
+        if (is(detail::FrozenType::Uint) && node_->payload <= UINT32_MAX) return static_cast<uint32_t>(node_->payload);
+        return defaultValue;
+    }
+
+    inline double asDouble(double defaultValue = 0.0) const {
+        if (is(detail::FrozenType::Double)) return doubleBits();
+        if (is(detail::FrozenType::Int)) return static_cast<double>(static_cast<int64_t>(node_->payload));
+        if (is(detail::FrozenType::Uint)) return static_cast<double>(node_->payload);
+        return defaultValue;
+    }
+
+    /**
+     * @brief 문자열 (이미지를 직접 참조, '\0' 종료)
+     */
+    inline std::string_view asStringView(std::string_view defaultValue = {}) const {
+        if (!isString()) return defaultValue;
+        return std::string_view(base_ + node_->payload, node_->length);
+    }
+
+    inline std::string asString(const std::string& defaultValue = "") const {
+        return isString() ? std::string(asStringView()) : defaultValue;
+    }
+
+    // 배열 요소
+    inline FrozenValue operator[](size_t index) const {
+        if (!isArray() || index >= node_->length) return FrozenValue();
+        return FrozenValue(base_, elements() + index);
+    }
+
+    /**
+     * @brief 객체 멤버 조회 (키 정렬 인덱스 이진 탐색)
+     */
+    inline FrozenValue find(std::string_view key) const {
+        if (!isObject()) return FrozenValue();
+        const uint32_t* index = sortedIndex();
+        size_t low = 0;
+        size_t high = node_->length;
+        while (low < high) {
+            const size_t mid = low + (high - low) / 2;
+            const int order = memberName(index[mid]).compare(key);
+            if (order == 0) {
+                // 같은 키가 여럿이면 가장 앞 멤버
+                size_t first = mid;
+                while (first > low && memberName(index[first - 1]) == key) --first;
+                return FrozenValue(base_, &members()[index[first]].value);
+            }
+            if (order < 0) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return FrozenValue();
+    }
+
+    inline FrozenValue operator[](const char* key) const { return find(key); }
+
+    // 객체 멤버 순회 (원래 순서)
+    inline std::string_view memberName(size_t index) const {
+        const auto& member = members()[index];
+        return std::string_view(base_ + member.keyOffset, member.keyLength);
+    }
+
+    inline FrozenValue memberValue(size_t index) const {
+        return FrozenValue(base_, &members()[index].value);
+    }
+
+private:
+    inline bool is(detail::FrozenType type) const { return node_ && node_->type == type; }
+
+    inline double doubleBits() const {
+        double d;
+        std::memcpy(&d, &node_->payload, sizeof(d));
+        return d;
+    }
+
+    inline const detail::FrozenNode* elements() const {
+        return reinterpret_cast<const detail::FrozenNode*>(base_ + node_->payload);
+    }
+
+    inline const detail::FrozenMember* members() const {
+        return reinterpret_cast<const detail::FrozenMember*>(base_ + node_->payload);
+    }
+
+    inline const uint32_t* sortedIndex() const {
+        return reinterpret_cast<const uint32_t*>(base_ + node_->payload + sizeof(detail::FrozenMember) * node_->length);
+    }
+
+    const char* base_ = nullptr;
+    const detail::FrozenNode* node_ = nullptr;
+};
+
+namespace detail {
+
+/**
+ * @brief 이미지 전체 오프셋/길이 검증 (열 때 한 번, 손상된 파일 방어)
+ */
+class FrozenValidator {
+public:
+    FrozenValidator(const char* base, size_t size) : base_(base), size_(size) {}
+
+    inline bool validate(uint64_t nodeOffset, size_t depth) const {
+        if (depth > kFrozenMaxDepth || !inRange(nodeOffset, sizeof(FrozenNode)) || nodeOffset % 8 != 0) return false;
+        const auto& node = *reinterpret_cast<const FrozenNode*>(base_ + nodeOffset);
+        switch (node.type) {
+        case FrozenType::Null: case FrozenType::False: case FrozenType::True:
+        case FrozenType::Int: case FrozenType::Uint: case FrozenType::Double:
+            return true;
+        case FrozenType::String:
+            return validString(node.payload, node.length);
+        case FrozenType::Array:
+            if (node.payload % 8 != 0 || !inRange(node.payload, sizeof(FrozenNode) * uint64_t(node.length))) return false;
+            for (uint32_t i = 0; i < node.length; ++i) {
+                if (!validate(node.payload + sizeof(FrozenNode) * i, depth + 1)) return false;
+            }
+            return true;
+        case FrozenType::Object: {
+            const uint64_t membersSize = sizeof(FrozenMember) * uint64_t(node.length);
+            if (node.payload % 8 != 0 || !inRange(node.payload, membersSize + sizeof(uint32_t) * uint64_t(node.length))) return false;
+            const auto* members = reinterpret_cast<const FrozenMember*>(base_ + node.payload);
+            const auto* index = reinterpret_cast<const uint32_t*>(base_ + node.payload + membersSize);
+            for (uint32_t i = 0; i < node.length; ++i) {
+                if (index[i] >= node.length) return false;
+                if (!validString(members[i].keyOffset, members[i].keyLength)) return false;
+                if (!validate(node.payload + sizeof(FrozenMember) * i + offsetof(FrozenMember, value), depth + 1)) return false;
+            }
+            return true;
+        }
+        }
+        return false;
+    }
+
+private:
+    inline bool inRange(uint64_t offset, uint64_t length) const {
+        return offset <= size_ && length <= size_ - offset;
+    }
+
+    inline bool validString(uint64_t offset, uint64_t length) const {
+        return inRange(offset, length + 1) && base_[offset + length] == '\0';
+    }
+
+    const char* base_;
+    size_t size_;
+};
+
+} // namespace detail
+
+// ========================================
+// 이미지 생성/공개
+// ========================================
+
+/**
+ * @brief JSON 텍스트 → 고정 이미지
+ *
+ * @return 파싱 실패 시 false (image 변경 없음)
+ */
+inline bool freezeJson(const std::string& jsonStr, std::string& image) {
+    rapidjson::Document document;
+    document.Parse(jsonStr.c_str(), jsonStr.size());
+    if (document.HasParseError()) return false;
+    image = detail::FrozenBuilder().build(document);
+    return true;
+}
+
+/**
+ * @brief 객체의 현재 직렬화 결과 → 고정 이미지
+ */
+template<typename T>
+inline bool freeze(const T& object, std::string& image) {
+    return freezeJson(object.toJson(), image);
+}
+
+/**
+ * @brief 이미지를 파일로 공개 (임시 파일에 쓴 뒤 rename으로 원자적 교체)
+ *
+ * 이미 매핑한 프로세스는 이전 inode를 계속 읽음
+ */
+inline bool writeFrozenFile(const std::string& path, const std::string& image) {
+    const std::string temporary = path + ".tmp";
+    const int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+
+    size_t written = 0;
+    while (written < image.size()) {
+        const ssize_t n = ::write(fd, image.data() + written, image.size() - written);
+        if (n <= 0) break;
+        written += static_cast<size_t>(n);
+    }
+    const bool ok = written == image.size() && ::fsync(fd) == 0;
+    ::close(fd);
+    if (!ok || std::rename(temporary.c_str(), path.c_str()) != 0) {
+        ::unlink(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+#if defined(__linux__) && defined(MFD_ALLOW_SEALING)
+
+/**
+ * @brief 이미지를 봉인된 memfd로 공개 (Linux)
+ *
+ * @return 파일 디스크립터 (실패 시 -1), 자식 프로세스 상속 또는 SCM_RIGHTS로 전달
+ *
+ * 쓰기/크기 변경이 봉인되므로 받는 쪽은 내용이 바뀌지 않음을 신뢰할 수 있음
+ */
+inline int publishFrozenMemfd(const std::string& image, const char* name = "jsonable-frozen") {
+    const int fd = ::memfd_create(name, MFD_ALLOW_SEALING);
+    if (fd < 0) return -1;
+
+    size_t written = 0;
+    while (written < image.size()) {
+        const ssize_t n = ::write(fd, image.data() + written, image.size() - written);
+        if (n <= 0) break;
+        written += static_cast<size_t>(n);
+    }
+    if (written != image.size() ||
+        ::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+#endif // __linux__
+
+// ========================================
+// 읽기: 매핑된 document
+// ========================================
+
+/**
+ * @brief 읽기 전용으로 매핑한 고정 document (getter는 JsonableBase와 같은 이름/규칙)
+ *
+ * @code
+ * // 설정 관리자 (한 번)
+ * std::string image;
+ * json::freezeJson(configText, image);
+ * json::writeFrozenFile("/run/app/config.frozen", image);
+ *
+ * // 각 워커
+ * json::FrozenDocument config;
+ * if (config.open("/run/app/config.frozen")) {
+ *     auto port = config.getInt64("port", 8080);
+ *     auto host = config.getStringView("host");          // 복사 없음
+ *     auto limit = config.root()["limits"]["rps"].asInt64();
+ * }
+ * @endcode
+ *
+ * 여러 스레드가 동시에 읽어도 안전함
+ */
+class FrozenDocument {
+public:
+    FrozenDocument() = default;
+    ~FrozenDocument() { close(); }
+
+    FrozenDocument(const FrozenDocument&) = delete;
+    FrozenDocument& operator=(const FrozenDocument&) = delete;
+
+    FrozenDocument(FrozenDocument&& other) noexcept { *this = std::move(other); }
+
+    FrozenDocument& operator=(FrozenDocument&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(mapped_, other.mapped_);
+            std::swap(root_, other.root_);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief 이미지 파일을 읽기 전용으로 매핑
+     */
+    inline bool open(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        const bool ok = openFd(fd);
+        ::close(fd);
+        return ok;
+    }
+
+    /**
+     * @brief 이미 열린 디스크립터(memfd 등)를 매핑 (fd는 호출자가 닫음)
+     */
+    inline bool openFd(int fd) {
+        close();
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || info.st_size <= 0) return false;
+
+        const size_t size = static_cast<size_t>(info.st_size);
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) return false;
+        if (!adopt(static_cast<const char*>(address), size)) {
+            ::munmap(address, size);
+            return false;
+        }
+        mapped_ = true;
+        return true;
+    }
+
+    /**
+     * @brief 메모리에 있는 이미지를 그대로 사용 (소유하지 않음, 8바이트 정렬 필요)
+     */
+    inline bool attach(const void* data, size_t size) {
+        close();
+        return adopt(static_cast<const char*>(data), size);
+    }
+
+    inline void close() {
+        if (mapped_ && data_) ::munmap(const_cast<char*>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+        root_ = FrozenValue();
+    }
+
+    inline bool isOpen() const { return data_ != nullptr; }
+    inline size_t imageSize() const { return size_; }
+    inline FrozenValue root() const { return root_; }
+
+    // ========================================
+    // 루트 멤버 읽기 (JsonableBase getter와 동일한 규칙)
+    // ========================================
+
+    inline std::string getString(const char* key, const std::string& defaultValue = "") const {
+        return root_.find(key).asString(defaultValue);
+    }
+
+    inline std::string_view getStringView(const char* key, std::string_view defaultValue = {}) const {
+        return root_.find(key).asStringView(defaultValue);
+    }
+
+    inline int64_t getInt64(const char* key, int64_t defaultValue = 0) const {
+        return root_.find(key).asInt64(defaultValue);
+    }
+
+    inline uint64_t getUInt64(const char* key, uint64_t defaultValue = 0) const {
+        return root_.find(key).asUInt64(defaultValue);
+    }
+
+    inline uint32_t getUInt32(const char* key, uint32_t defaultValue = 0) const {
+        return root_.find(key).asUInt32(defaultValue);
+    }
+
+    inline double getDouble(const char* key, double defaultValue = 0.0) const {
+        return root_.find(key).asDouble(defaultValue);
+    }
+
+    inline float getFloat(const char* key, float defaultValue = 0.0f) const {
+        return static_cast<float>(getDouble(key, static_cast<double>(defaultValue)));
+    }
+
+    inline bool getBool(const char* key, bool defaultValue = false) const {
+        return root_.find(key).asBool(defaultValue);
+    }
+
+    template<typename T>
+    inline std::vector<T> getArray(const char* key) const {
+        static_assert(is_json_primitive_v<T>, "Array elements must be JSON primitive types only");
+
+        std::vector<T> result;
+        const FrozenValue array = root_.find(key);
+        if (!array.isArray()) return result;
+        result.reserve(array.size());
+        for (size_t i = 0; i < array.size(); ++i) {
+            const FrozenValue element = array[i];
+            if constexpr (std::is_same_v<T, std::string>) {
+                result.push_back(element.asString());
+            } else if constexpr (std::is_same_v<T, bool>) {
+                result.push_back(element.asBool());
+            } else if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+                result.push_back(static_cast<T>(element.asDouble()));
+            } else if constexpr (std::is_same_v<T, uint64_t>) {
+                result.push_back(element.asUInt64());
+            } else {
+                result.push_back(static_cast<T>(element.asInt64()));
+            }
+        }
+        return result;
+    }
+
+    inline bool hasKey(const char* key) const { return root_.find(key).isValid(); }
+    inline bool isArray(const char* key) const { return root_.find(key).isArray(); }
+    inline bool isObject(const char* key) const { return root_.find(key).isObject(); }
+
+private:
+    inline bool adopt(const char* data, size_t size) {
+        if (size < sizeof(detail::FrozenHeader) || reinterpret_cast<uintptr_t>(data) % 8 != 0) return false;
+        detail::FrozenHeader header;
+        std::memcpy(&header, data, sizeof(header));
+        if (header.magic != detail::kFrozenMagic || header.version != detail::kFrozenVersion ||
+            header.totalSize != size || !detail::FrozenValidator(data, size).validate(header.rootOffset, 0)) {
+            return false;
+        }
+        data_ = data;
+        size_ = size;
+        root_ = FrozenValue(data, reinterpret_cast<const detail::FrozenNode*>(data + header.rootOffset));
+        return true;
+    }
+
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    FrozenValue root_;
+};
+
+} // namespace json
+
+#endif // __unix__ || __APPLE__
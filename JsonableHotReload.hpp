@@ -0,0 +1,258 @@
+#pragma once
+
+/**
+ * JsonableHotReload.hpp - 설정 파일 변경 감지 + 스냅샷 교체 (완전 inline, Linux 전용)
+ *
+ * 역할: inotify로 파일 변경을 감지해 백그라운드 스레드에서 다시 파싱하고
+ *       완성된 불변 객체를 원자적 포인터 교체로 게시
+ *       - 읽기: 락 없음 (epoch 카운터 증감 + shared_ptr 복사)
+ *       - 쓰기: 감시 스레드(또는 reloadNow 호출자)만 파싱/검증 비용 부담
+ *       - 회수: 교체 후 이전 epoch의 읽기가 끝난 뒤에만 이전 포인터 해제
+ *
+ * 파일 대신 디렉토리를 감시하므로 "임시 파일 작성 후 rename" 방식 교체도 감지됨
+ * 파싱/검증에 실패하면 기존 스냅샷 유지
+ */
+
+#if defined(__linux__)
+
+#define JSONABLE_HAS_HOT_RELOAD 1
+
+#include <string>
+#include <memory>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "FromJsonable.hpp"
+
+namespace json {
+
+/**
+ * @brief 파일 변경 시 자동으로 다시 읽히는 Jsonable 스냅샷
+ *
+ * @code
+ * json::HotReload<ServiceConfig> config;
+ * config.setValidator([](const ServiceConfig& c) { return c.workers > 0; });
+ * if (!config.start("/etc/service/config.json")) { ... }
+ *
+ * // 요청 스레드 (락 없음)
+ * auto current = config.snapshot();
+ * useTimeout(current->timeoutMs);
+ * @endcode
+ *
+ * snapshot()이 반환한 객체는 이후 교체와 무관하게 유효함 (불변으로 취급)
+ */
+template<typename T>
+class HotReload {
+public:
+    using Validator = std::function<bool(const T&)>;
+
+    HotReload() = default;
+
+    ~HotReload() {
+        stop();
+        delete current_.load();
+    }
+
+    HotReload(const HotReload&) = delete;
+    HotReload& operator=(const HotReload&) = delete;
+
+    // ========================================
+    // 감시 제어
+    // ========================================
+
+    /**
+     * @brief 파일을 처음 읽고 감시 스레드 시작
+     *
+     * @return 첫 로드 실패, 이미 실행 중, inotify 설정 실패 시 false
+     */
+    inline bool start(const std::string& path) {
+        if (running_) return false;
+        path_ = path;
+        if (!reloadNow()) return false;
+
+        size_t slash = path_.rfind('/');
+        std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path_.substr(0, slash));
+        fileName_ = slash == std::string::npos ? path_ : path_.substr(slash + 1);
+
+        inotifyFd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (inotifyFd_ < 0) return false;
+        if (inotify_add_watch(inotifyFd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0 ||
+            pipe2(wakePipe_, O_NONBLOCK | O_CLOEXEC) != 0) {
+            closeDescriptors();
+            return false;
+        }
+
+        running_ = true;
+        watcher_ = std::thread([this] { watchLoop(); });
+        return true;
+    }
+
+    inline void stop() {
+        if (!running_) return;
+        running_ = false;
+        char byte = 0;
+        (void)!::write(wakePipe_[1], &byte, 1);
+        if (watcher_.joinable()) watcher_.join();
+        closeDescriptors();
+    }
+
+    inline bool running() const { return running_; }
+
+    /**
+     * @brief 파일을 지금 다시 읽어 게시 (호출 스레드에서 파싱)
+     *
+     * @return 읽기/파싱/검증 실패 시 false (기존 스냅샷 유지)
+     */
+    inline bool reloadNow() {
+        std::lock_guard<std::mutex> lock(reloadMutex_);
+        std::string text;
+        if (!readFile(text) || !isWellFormed(text)) {
+            ++failedReloads_;
+            return false;
+        }
+
+        auto next = std::make_shared<T>();
+        next->fromJson(text);
+        if (validator_ && !validator_(*next)) {
+            ++failedReloads_;
+            return false;
+        }
+        publish(std::move(next));
+        return true;
+    }
+
+    /**
+     * @brief 게시 전 객체 검사 (start 전에 설정)
+     */
+    inline void setValidator(Validator validator) { validator_ = std::move(validator); }
+
+    // ========================================
+    // 읽기
+    // ========================================
+
+    /**
+     * @brief 현재 스냅샷 (아직 로드되지 않았으면 nullptr)
+     */
+    inline std::shared_ptr<const T> snapshot() const {
+        uint64_t epoch;
+        for (;;) {
+            epoch = epoch_.load();
+            readers_[epoch & 1].fetch_add(1);
+            // 카운터를 올리는 사이 교체가 일어났으면 새 epoch로 다시
+            if (epoch_.load() == epoch) break;
+            readers_[epoch & 1].fetch_sub(1);
+        }
+        const std::shared_ptr<const T>* holder = current_.load();
+        std::shared_ptr<const T> result = holder ? *holder : nullptr;
+        readers_[epoch & 1].fetch_sub(1);
+        return result;
+    }
+
+    // 성공한 로드 수 (첫 로드 포함)
+    inline uint64_t version() const { return version_.load(); }
+    inline uint64_t failedReloads() const { return failedReloads_.load(); }
+
+private:
+    /**
+     * @brief 새 스냅샷 게시 (reloadMutex_ 보유 상태)
+     *
+     * 교체 후 epoch를 넘기고, 이전 epoch 칸의 읽기가 모두 빠지면 이전 포인터 해제
+     * 새 epoch로 들어온 읽기는 반드시 새 포인터를 보므로 이전 포인터를 잡을 수 없음
+     */
+    inline void publish(std::shared_ptr<const T> next) {
+        auto* holder = new std::shared_ptr<const T>(std::move(next));
+        const std::shared_ptr<const T>* previous = current_.exchange(holder);
+        uint64_t epoch = epoch_.fetch_add(1);
+        while (readers_[epoch & 1].load() != 0) std::this_thread::yield();
+        delete previous;
+        ++version_;
+    }
+
+    inline bool readFile(std::string& out) const {
+        int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        char buffer[64 * 1024];
+        for (;;) {
+            ssize_t n = ::read(fd, buffer, sizeof(buffer));
+            if (n < 0) {
+                ::close(fd);
+                return false;
+            }
+            if (n == 0) break;
+            out.append(buffer, static_cast<size_t>(n));
+        }
+        ::close(fd);
+        return true;
+    }
+
+    // 문법 검사만 (document 생성 없음): 쓰다 만 파일을 게시하지 않기 위함
+    static inline bool isWellFormed(const std::string& text) {
+        rapidjson::BaseReaderHandler<> handler;
+        rapidjson::Reader reader;
+        rapidjson::StringStream stream(text.c_str());
+        return !reader.Parse<rapidjson::kParseNoFlags>(stream, handler).IsError();
+    }
+
+    inline void watchLoop() {
+        alignas(struct inotify_event) char buffer[4096];
+        pollfd fds[2] = {{inotifyFd_, POLLIN, 0}, {wakePipe_[0], POLLIN, 0}};
+
+        while (running_) {
+            if (::poll(fds, 2, -1) < 0) continue;
+            if (fds[1].revents) break;
+            if (!(fds[0].revents & POLLIN)) continue;
+
+            // 쌓인 이벤트를 모두 비운 뒤 한 번만 다시 읽음
+            bool changed = false;
+            for (;;) {
+                ssize_t n = ::read(inotifyFd_, buffer, sizeof(buffer));
+                if (n <= 0) break;
+                for (char* p = buffer; p < buffer + n;) {
+                    auto* event = reinterpret_cast<struct inotify_event*>(p);
+                    if (event->mask & IN_Q_OVERFLOW) changed = true;
+                    else if (event->len && fileName_ == event->name) changed = true;
+                    p += sizeof(struct inotify_event) + event->len;
+                }
+            }
+            if (changed) reloadNow();
+        }
+    }
+
+    inline void closeDescriptors() {
+        if (inotifyFd_ >= 0) ::close(inotifyFd_);
+        if (wakePipe_[0] >= 0) ::close(wakePipe_[0]);
+        if (wakePipe_[1] >= 0) ::close(wakePipe_[1]);
+        inotifyFd_ = -1;
+        wakePipe_[0] = wakePipe_[1] = -1;
+    }
+
+    std::string path_;
+    std::string fileName_;
+    Validator validator_;
+
+    int inotifyFd_ = -1;
+    int wakePipe_[2] = {-1, -1};
+    std::atomic<bool> running_{false};
+    std::thread watcher_;
+    std::mutex reloadMutex_;
+
+    std::atomic<const std::shared_ptr<const T>*> current_{nullptr};
+    mutable std::atomic<uint64_t> epoch_{0};
+    mutable std::atomic<uint64_t> readers_[2] = {};
+    std::atomic<uint64_t> version_{0};
+    std::atomic<uint64_t> failedReloads_{0};
+};
+
+} // namespace json
+
+#endif // __linux__
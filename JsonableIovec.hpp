@@ -0,0 +1,229 @@
+#pragma once
+
+/**
+ * JsonableIovec.hpp - scatter-gather(iovec) 직렬화 출력 (완전 inline, POSIX 전용)
+ *
+ * 역할: 긴 문자열 값은 document 안의 원본을 그대로 가리키는 세그먼트로,
+ *       구조/짧은 값은 작은 생성 버퍼 세그먼트로 출력하여
+ *       writev/sendmsg로 큰 페이로드를 중간 복사 없이 내보냄
+ *
+ * 이스케이프가 필요한 문자열('"', '\\', 제어 문자 포함)은 길어도 기존처럼 복사 출력
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define JSONABLE_HAS_IOVEC 1
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cerrno>
+#include <climits>
+#include <algorithm>
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "JsonableWriter.hpp"
+
+namespace json {
+
+/**
+ * @brief 생성 바이트 + 외부 참조로 이루어진 출력 버퍼
+ *
+ * RapidJSON OutputStream 개념(Put/Flush/Push)을 만족하므로 Writer가 직접 기록함
+ *
+ * @code
+ * json::IovecBuffer out;
+ * response.toJsonIov(out);
+ * out.writeTo(socketFd);            // 또는 out.segments()를 sendmsg에 전달
+ * @endcode
+ *
+ * 참조 세그먼트는 원본 객체의 document를 가리키므로
+ * 객체를 수정하거나 파괴하기 전에 전송을 마칠 것
+ */
+class IovecBuffer {
+public:
+    typedef char Ch;
+
+    // 기본: 이 길이 이상의 문자열만 제자리 참조 (짧은 값은 복사가 더 쌈)
+    static constexpr size_t kDefaultReferenceThreshold = 1024;
+
+    explicit IovecBuffer(size_t referenceThreshold = kDefaultReferenceThreshold)
+        : threshold_(referenceThreshold) {}
+
+    // ========================================
+    // OutputStream 개념
+    // ========================================
+
+    inline void Put(char c) {
+        openGenerated(1);
+        generated_.push_back(c);
+    }
+
+    // 연속 count 바이트 확보 (다음 Put/Push 전까지 유효)
+    inline char* Push(size_t count) {
+        openGenerated(count);
+        generated_.resize(generated_.size() + count);
+        return &generated_[generated_.size() - count];
+    }
+
+    inline void Flush() {}
+
+    // ========================================
+    // 세그먼트
+    // ========================================
+
+    /**
+     * @brief 외부 바이트를 복사 없이 세그먼트로 추가
+     */
+    inline void reference(const char* data, size_t size) {
+        if (size == 0) return;
+        pieces_.push_back(Piece{data, 0, size});
+        total_ += size;
+        dirty_ = true;
+    }
+
+    inline size_t referenceThreshold() const { return threshold_; }
+
+    /**
+     * @brief writev/sendmsg용 세그먼트 목록 (다음 기록 전까지 유효)
+     */
+    inline const std::vector<iovec>& segments() const {
+        if (dirty_) {
+            iovecs_.clear();
+            iovecs_.reserve(pieces_.size());
+            for (const auto& piece : pieces_) {
+                const char* base = piece.external ? piece.external : generated_.data() + piece.offset;
+                iovecs_.push_back(iovec{const_cast<char*>(base), piece.length});
+            }
+            dirty_ = false;
+        }
+        return iovecs_;
+    }
+
+    inline size_t size() const { return total_; }
+    inline bool empty() const { return total_ == 0; }
+
+    // 복사된 바이트 수 (나머지는 참조)
+    inline size_t generatedSize() const { return generated_.size(); }
+
+    inline void clear() {
+        generated_.clear();
+        pieces_.clear();
+        iovecs_.clear();
+        total_ = 0;
+        dirty_ = false;
+    }
+
+    /**
+     * @brief 모든 세그먼트를 이어 붙인 문자열 (디버깅/비교용)
+     */
+    inline std::string toString() const {
+        std::string result;
+        result.reserve(total_);
+        for (const auto& segment : segments()) result.append(static_cast<const char*>(segment.iov_base), segment.iov_len);
+        return result;
+    }
+
+    /**
+     * @brief fd로 전부 기록 (IOV_MAX 단위 writev, 부분 기록은 이어서 재시도)
+     *
+     * @return 모두 기록되면 true
+     */
+    inline bool writeTo(int fd) const {
+        std::vector<iovec> pending = segments();
+        size_t first = 0;
+        while (first < pending.size()) {
+            const size_t batch = std::min(pending.size() - first, static_cast<size_t>(kMaxBatch));
+            ssize_t written = ::writev(fd, pending.data() + first, static_cast<int>(batch));
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            size_t remaining = static_cast<size_t>(written);
+            while (first < pending.size() && remaining >= pending[first].iov_len) {
+                remaining -= pending[first].iov_len;
+                ++first;
+            }
+            if (remaining) {
+                pending[first].iov_base = static_cast<char*>(pending[first].iov_base) + remaining;
+                pending[first].iov_len -= remaining;
+            }
+        }
+        return true;
+    }
+
+private:
+#if defined(IOV_MAX)
+    static constexpr int kMaxBatch = IOV_MAX;
+#else
+    static constexpr int kMaxBatch = 1024;
+#endif
+
+    // external == nullptr 이면 generated_[offset, offset + length)
+    struct Piece {
+        const char* external;
+        size_t offset;
+        size_t length;
+    };
+
+    // 마지막 세그먼트가 생성 바이트면 이어 쓰고, 아니면 새 세그먼트 시작
+    inline void openGenerated(size_t count) {
+        if (pieces_.empty() || pieces_.back().external) {
+            pieces_.push_back(Piece{nullptr, generated_.size(), 0});
+        }
+        pieces_.back().length += count;
+        total_ += count;
+        dirty_ = true;
+    }
+
+    size_t threshold_;
+    std::string generated_;
+    std::vector<Piece> pieces_;
+    size_t total_ = 0;
+    mutable std::vector<iovec> iovecs_;
+    mutable bool dirty_ = false;
+};
+
+namespace detail {
+
+/**
+ * @brief 긴 문자열 값을 IovecBuffer 참조 세그먼트로 출력하는 Writer
+ *
+ * 키는 항상 복사 (대개 짧음), 값 문자열만 대상
+ * 전달되는 문자열 포인터가 출력 전송 시점까지 유효해야 함 (document 값)
+ */
+class IovecWriter : public JsonWriter<IovecBuffer> {
+    using Base = JsonWriter<IovecBuffer>;
+
+public:
+    explicit IovecWriter(IovecBuffer& buffer) : Base(buffer), buffer_(buffer) {}
+
+    inline bool String(const char* str, rapidjson::SizeType length, bool copy = false) {
+        if (length < buffer_.referenceThreshold() || needsEscape(str, length)) {
+            return Base::String(str, length, copy);
+        }
+        this->Prefix(rapidjson::kStringType);
+        buffer_.Put('"');
+        buffer_.reference(str, length);
+        buffer_.Put('"');
+        return this->EndValue(true);
+    }
+
+private:
+    static inline bool needsEscape(const char* str, size_t length) {
+        for (size_t i = 0; i < length; ++i) {
+            const unsigned char c = static_cast<unsigned char>(str[i]);
+            if (c < 0x20 || c == '"' || c == '\\') return true;
+        }
+        return false;
+    }
+
+    IovecBuffer& buffer_;
+};
+
+} // namespace detail
+} // namespace json
+
+#endif // __unix__ || __APPLE__
@@ -0,0 +1,217 @@
+#pragma once
+
+/**
+ * JsonableLazy.hpp - 지연 구체화 객체 벡터 (완전 inline)
+ *
+ * 역할: 레코드 원문(공유 버퍼 안의 바이트 범위)만 들고 있다가
+ *       요소에 처음 접근할 때 fromJson(범위)로 객체를 만듦
+ *       - 배열/NDJSON 분할은 값 경계만 훑음 (document 생성 없음)
+ *       - 선택적으로 구체화된 객체 수 제한 (LRU 제거)
+ *
+ * 스레드 안전하지 않음 (요청 단위 사용 전제)
+ */
+
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <string_view>
+#include <cstddef>
+#include <cstring>
+
+#include "JsonableScan.hpp"
+
+namespace json {
+
+/**
+ * @brief 접근 시점에 구체화되는 Jsonable 벡터
+ *
+ * @code
+ * json::LazyVector<User> users;
+ * users.assignArray(responseBody);            // [{...},{...},...] 경계만 분할
+ *
+ * auto user = users.get(3);                   // 여기서 처음 fromJson
+ * if (user) render(user->name);
+ *
+ * json::LazyVector<User> recent(64);          // 최대 64개만 구체화 유지 (LRU)
+ * recent.assignNdjson(std::move(lines));
+ * @endcode
+ *
+ * get()은 shared_ptr을 반환하므로 캐시에서 밀려나도 받은 쪽 객체는 유효함
+ */
+template<typename T>
+class LazyVector {
+public:
+    struct Range {
+        size_t offset;
+        size_t length;
+    };
+
+    /**
+     * @param cacheCapacity 동시에 유지할 구체화 객체 수 (0 = 제한 없음)
+     */
+    explicit LazyVector(size_t cacheCapacity = 0) : capacity_(cacheCapacity) {}
+
+    // ========================================
+    // 원문 설정
+    // ========================================
+
+    /**
+     * @brief 최상위 JSON 배열을 요소 범위로 분할하여 보관
+     *
+     * @return 배열이 아니거나 깨졌으면 false (기존 내용 유지)
+     */
+    inline bool assignArray(std::string json) {
+        auto buffer = std::make_shared<const std::string>(std::move(json));
+        std::vector<Range> ranges;
+        if (!splitArray(*buffer, ranges)) return false;
+        assign(std::move(buffer), std::move(ranges));
+        return true;
+    }
+
+    /**
+     * @brief NDJSON 줄을 요소로 보관 (빈 줄 무시, 줄 끝 '\r' 제거)
+     */
+    inline void assignNdjson(std::string ndjson) {
+        auto buffer = std::make_shared<const std::string>(std::move(ndjson));
+        std::vector<Range> ranges;
+        const char* base = buffer->data();
+        const char* end = base + buffer->size();
+        for (const char* p = base; p < end;) {
+            const char* newline = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            const char* lineEnd = newline ? newline : end;
+            const char* first = detail::skipSpace(p, lineEnd);
+            const char* last = lineEnd;
+            while (last > first && (last[-1] == '\r' || last[-1] == ' ' || last[-1] == '\t')) --last;
+            if (last > first) ranges.push_back(Range{static_cast<size_t>(first - base), static_cast<size_t>(last - first)});
+            p = newline ? newline + 1 : end;
+        }
+        assign(std::move(buffer), std::move(ranges));
+    }
+
+    /**
+     * @brief 이미 알고 있는 범위로 공유 버퍼 참조 (다른 LazyVector와 버퍼 공유 가능)
+     */
+    inline void assign(std::shared_ptr<const std::string> buffer, std::vector<Range> ranges) {
+        buffer_ = std::move(buffer);
+        ranges_ = std::move(ranges);
+        cache_.assign(ranges_.size(), nullptr);
+        lruPositions_.assign(capacity_ ? ranges_.size() : 0, lru_.end());
+        lru_.clear();
+        materialized_ = 0;
+    }
+
+    inline void clear() { assign(nullptr, {}); }
+
+    // ========================================
+    // 접근
+    // ========================================
+
+    inline size_t size() const { return ranges_.size(); }
+    inline bool empty() const { return ranges_.empty(); }
+
+    /**
+     * @brief 요소 원문 (구체화하지 않음)
+     */
+    inline std::string_view raw(size_t index) const {
+        if (index >= ranges_.size()) return std::string_view();
+        return std::string_view(buffer_->data() + ranges_[index].offset, ranges_[index].length);
+    }
+
+    /**
+     * @brief 요소 객체 (처음 접근 시 구체화, 범위 밖이면 nullptr)
+     */
+    inline std::shared_ptr<const T> get(size_t index) {
+        if (index >= ranges_.size()) return nullptr;
+        if (cache_[index]) {
+            touch(index);
+            return cache_[index];
+        }
+
+        auto object = std::make_shared<T>();
+        object->fromJson(buffer_->data() + ranges_[index].offset, ranges_[index].length);
+        cache_[index] = object;
+        ++materialized_;
+        if (capacity_) {
+            lru_.push_front(index);
+            lruPositions_[index] = lru_.begin();
+            if (materialized_ > capacity_) evict(lru_.back());
+        }
+        return object;
+    }
+
+    inline std::shared_ptr<const T> operator[](size_t index) { return get(index); }
+
+    /**
+     * @brief 캐시를 거치지 않고 호출자 객체로 구체화
+     */
+    inline bool load(size_t index, T& out) const {
+        if (index >= ranges_.size()) return false;
+        out.fromJson(buffer_->data() + ranges_[index].offset, ranges_[index].length);
+        return true;
+    }
+
+    inline bool isMaterialized(size_t index) const {
+        return index < cache_.size() && cache_[index] != nullptr;
+    }
+
+    inline size_t materializedCount() const { return materialized_; }
+    inline size_t cacheCapacity() const { return capacity_; }
+
+    // 구체화된 객체만 해제 (원문은 유지)
+    inline void dropCache() {
+        cache_.assign(ranges_.size(), nullptr);
+        lruPositions_.assign(capacity_ ? ranges_.size() : 0, lru_.end());
+        lru_.clear();
+        materialized_ = 0;
+    }
+
+private:
+    /**
+     * @brief 최상위 배열 요소 범위 찾기 (값 경계만 확인, 요소 문법은 구체화 시 검사)
+     */
+    static inline bool splitArray(const std::string& json, std::vector<Range>& ranges) {
+        const char* base = json.data();
+        const char* end = base + json.size();
+        const char* p = detail::skipSpace(base, end);
+        if (p >= end || *p != '[') return false;
+        p = detail::skipSpace(p + 1, end);
+        if (p < end && *p == ']') return detail::skipSpace(p + 1, end) == end;
+
+        while (p < end) {
+            detail::ScanKind kind;
+            bool escaped;
+            const char* valueEnd = detail::skipValue(p, end, kind, escaped);
+            if (!valueEnd) return false;
+            ranges.push_back(Range{static_cast<size_t>(p - base), static_cast<size_t>(valueEnd - p)});
+            p = detail::skipSpace(valueEnd, end);
+            if (p < end && *p == ']') return detail::skipSpace(p + 1, end) == end;
+            if (p >= end || *p != ',') return false;
+            p = detail::skipSpace(p + 1, end);
+        }
+        return false;
+    }
+
+    inline void touch(size_t index) {
+        if (capacity_) lru_.splice(lru_.begin(), lru_, lruPositions_[index]);
+    }
+
+    inline void evict(size_t index) {
+        lru_.erase(lruPositions_[index]);
+        lruPositions_[index] = lru_.end();
+        cache_[index].reset();
+        --materialized_;
+    }
+
+    size_t capacity_;
+    std::shared_ptr<const std::string> buffer_;
+    std::vector<Range> ranges_;
+    std::vector<std::shared_ptr<T>> cache_;
+
+    // capacity_ > 0 일 때만 사용: 앞쪽이 최근 접근
+    std::list<size_t> lru_;
+    std::vector<std::list<size_t>::iterator> lruPositions_;
+    size_t materialized_ = 0;
+};
+
+} // namespace json
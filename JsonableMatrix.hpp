@@ -0,0 +1,82 @@
+#pragma once
+
+/**
+ * JsonableMatrix.hpp - 다차원 숫자 배열 값 타입 (완전 inline)
+ *
+ * 역할: [[...],[...]] 형태의 직사각형 중첩 배열을
+ *       연속 버퍼(row-major) + shape로 표현
+ */
+
+#include <vector>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+namespace json {
+
+/**
+ * @brief N차원 직사각형 숫자 배열 (row-major 연속 버퍼)
+ *
+ * @code
+ * json::Matrix<double> features;
+ * features.shape = {2, 3};
+ * features.data = {1, 2, 3, 4, 5, 6};   // [[1,2,3],[4,5,6]]
+ * features(1, 2) = 7.0;
+ *
+ * setMatrix("features", features);
+ * auto loaded = getMatrix<double>("features");
+ * @endcode
+ *
+ * shape가 비어 있으면 스칼라 하나 (data 크기 1)
+ */
+template<typename T>
+struct Matrix {
+    std::vector<size_t> shape;
+    std::vector<T> data;
+
+    Matrix() = default;
+    Matrix(std::vector<size_t> shape_, std::vector<T> data_)
+        : shape(std::move(shape_)), data(std::move(data_)) {}
+
+    /**
+     * @brief shape가 나타내는 요소 수 (빈 shape = 스칼라 1개)
+     */
+    static inline size_t elementCount(const std::vector<size_t>& dims) {
+        size_t count = 1;
+        for (size_t dim : dims) count *= dim;
+        return count;
+    }
+
+    inline size_t rank() const { return shape.size(); }
+    inline bool empty() const { return data.empty(); }
+
+    /**
+     * @brief shape와 data 크기가 일치하는지
+     */
+    inline bool isValid() const { return elementCount(shape) == data.size(); }
+
+    /**
+     * @brief 다차원 인덱스 접근 (범위 검사 없음)
+     */
+    template<typename... Index>
+    inline T& operator()(Index... index) {
+        return data[offset({static_cast<size_t>(index)...})];
+    }
+
+    template<typename... Index>
+    inline const T& operator()(Index... index) const {
+        return data[offset({static_cast<size_t>(index)...})];
+    }
+
+private:
+    inline size_t offset(std::initializer_list<size_t> index) const {
+        size_t linear = 0;
+        size_t dim = 0;
+        for (size_t i : index) {
+            linear = linear * shape[dim++] + i;
+        }
+        return linear;
+    }
+};
+
+} // namespace json
@@ -0,0 +1,191 @@
+#pragma once
+
+/**
+ * JsonableMinify.hpp - 제자리(in-place) JSON 압축 (완전 inline)
+ *
+ * 역할: document 생성이나 할당 없이 버퍼 안에서 불필요한 공백 제거
+ *       (SSE2 16바이트 / SWAR 8바이트 블록 단위 따옴표·이스케이프 추적)
+ */
+
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JSONABLE_MINIFY_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace json {
+namespace detail {
+
+// ========================================
+// 블록 분류 (바이트당 1비트 마스크)
+// ========================================
+
+/**
+ * @brief 블록 안 특수 바이트 위치 (비트 i = 블록의 i번째 바이트)
+ */
+struct MinifyMasks {
+    uint32_t quote;
+    uint32_t backslash;
+    uint32_t whitespace;
+};
+
+inline unsigned lowestBitIndex(uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+#if defined(JSONABLE_MINIFY_SSE2)
+
+constexpr size_t kMinifyBlock = 16;
+
+inline MinifyMasks classifyBlock(const char* p) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    auto match = [&chunk](char c) {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(c))));
+    };
+    return MinifyMasks{
+        match('"'),
+        match('\\'),
+        match(' ') | match('\n') | match('\r') | match('\t')
+    };
+}
+
+#else
+
+constexpr size_t kMinifyBlock = 8;
+
+/**
+ * @brief 8바이트 중 값이 c인 바이트의 최상위 비트를 세움 (자리올림 전파 없는 정확한 판정)
+ */
+inline uint64_t swarEquals(uint64_t chunk, char c) {
+    const uint64_t t = chunk ^ (0x0101010101010101ULL * static_cast<uint8_t>(c));
+    return ~(((t & 0x7F7F7F7F7F7F7F7FULL) + 0x7F7F7F7F7F7F7F7FULL) | t | 0x7F7F7F7F7F7F7F7FULL);
+}
+
+/**
+ * @brief 바이트별 최상위 비트 → 하위 8비트 마스크 (바이트 i → 비트 i)
+ */
+inline uint32_t swarMovemask(uint64_t highBits) {
+    return static_cast<uint32_t>(((highBits >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+inline MinifyMasks classifyBlock(const char* p) {
+    uint64_t chunk;
+    std::memcpy(&chunk, p, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    chunk = __builtin_bswap64(chunk);
+#endif
+    return MinifyMasks{
+        swarMovemask(swarEquals(chunk, '"')),
+        swarMovemask(swarEquals(chunk, '\\')),
+        swarMovemask(swarEquals(chunk, ' ') | swarEquals(chunk, '\n') |
+                     swarEquals(chunk, '\r') | swarEquals(chunk, '\t'))
+    };
+}
+
+#endif
+
+inline bool isJsonWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+} // namespace detail
+
+// ========================================
+// 공개 API
+// ========================================
+
+/**
+ * @brief JSON 텍스트에서 의미 없는 공백을 제자리에서 제거
+ *
+ * - 문자열 내부(이스케이프 포함)는 그대로 보존
+ * - 문법 검증은 하지 않음 (잘못된 입력도 범위 밖 접근 없이 처리)
+ * - 결과는 buf 앞부분에 기록되며 종료 문자는 쓰지 않음
+ *
+ * @return 압축 후 길이
+ */
+inline size_t minify(char* buf, size_t len) {
+    using namespace detail;
+
+    const char* read = buf;
+    const char* const end = buf + len;
+    char* write = buf;
+    bool inString = false;
+
+    while (read < end) {
+        if (static_cast<size_t>(end - read) >= kMinifyBlock) {
+            const MinifyMasks masks = classifyBlock(read);
+
+            if (inString) {
+                const uint32_t special = masks.quote | masks.backslash;
+                if (special == 0) {
+                    // 문자열 본문: 블록 통째로 복사
+                    if (write != read) std::memmove(write, read, kMinifyBlock);
+                    write += kMinifyBlock;
+                    read += kMinifyBlock;
+                    continue;
+                }
+                // 첫 특수 문자 앞까지 복사 후 아래 바이트 단위 처리로
+                const size_t prefix = lowestBitIndex(special);
+                if (write != read) std::memmove(write, read, prefix);
+                write += prefix;
+                read += prefix;
+            } else {
+                // 문자열 밖: 첫 따옴표 전까지 공백이 아닌 바이트만 남김
+                const size_t span = masks.quote ? lowestBitIndex(masks.quote) : kMinifyBlock;
+                const uint32_t spanMask = span == 32 ? 0xFFFFFFFFu : ((1u << span) - 1);
+                uint32_t keep = ~masks.whitespace & spanMask;
+                if (keep == spanMask) {
+                    if (write != read) std::memmove(write, read, span);
+                    write += span;
+                } else {
+                    while (keep) {
+                        *write++ = read[lowestBitIndex(keep)];
+                        keep &= keep - 1;
+                    }
+                }
+                read += span;
+                if (span == kMinifyBlock) continue;
+            }
+        }
+
+        // 바이트 단위 처리 (특수 문자 또는 블록 미만 꼬리)
+        const char c = *read++;
+        if (inString) {
+            *write++ = c;
+            if (c == '\\') {
+                if (read < end) *write++ = *read++;
+            } else if (c == '"') {
+                inString = false;
+            }
+        } else if (!isJsonWhitespace(c)) {
+            *write++ = c;
+            if (c == '"') inString = true;
+        }
+    }
+
+    return static_cast<size_t>(write - buf);
+}
+
+/**
+ * @brief std::string 버전 (제자리 압축 후 길이 조정)
+ */
+inline void minify(std::string& text) {
+    if (text.empty()) return;
+    text.resize(minify(&text[0], text.size()));
+}
+
+} // namespace json
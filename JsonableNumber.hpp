@@ -0,0 +1,407 @@
+#pragma once
+
+/**
+ * JsonableNumber.hpp - 숫자 텍스트 변환 커널 (완전 inline)
+ *
+ * 역할: JSON 숫자 텍스트 → 정수/실수 변환 (SWAR 8자리 일괄 처리)
+ *       및 고정 소수점 10진수 ↔ 텍스트 변환, 정수 → 텍스트 변환 (2자리 표)
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <charconv>
+#include <string>
+#include <map>
+#include <functional>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace json {
+namespace detail {
+
+/**
+ * @brief 숫자 텍스트 변환 결과
+ *
+ * 분류 규칙은 RapidJSON Reader와 동일:
+ * - 소수점/지수가 없고 int64/uint64 범위면 정수
+ * - 그 외는 double
+ */
+struct ParsedNumber {
+    enum class Kind : uint8_t { Int64, UInt64, Double };
+
+    Kind kind = Kind::Int64;
+    int64_t i = 0;
+    uint64_t u = 0;
+    double d = 0.0;
+};
+
+// ========================================
+// SWAR (SIMD within a register) 8자리 변환
+// ========================================
+
+/**
+ * @brief 8바이트가 모두 ASCII 숫자인지 확인 (분기 없음)
+ */
+inline bool isEightDigits(uint64_t chunk) {
+    return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+/**
+ * @brief little-endian으로 적재한 8자리 숫자를 곱셈 3회로 변환
+ */
+inline uint32_t parseEightDigits(uint64_t chunk) {
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+    return static_cast<uint32_t>(chunk);
+}
+
+inline bool loadEightDigits(const char* p, uint64_t& chunk) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    (void)p;
+    (void)chunk;
+    return false;   // big-endian: 자리별 경로 사용
+#else
+    std::memcpy(&chunk, p, sizeof(chunk));
+    return isEightDigits(chunk);
+#endif
+}
+
+/**
+ * @brief 연속된 숫자를 mantissa에 누적
+ *
+ * @param significant 유효 자릿수 (19를 넘으면 overflow로 판단)
+ * @return 소비한 자릿수
+ */
+inline size_t accumulateDigits(const char*& p, const char* end, uint64_t& mantissa, int& significant) {
+    const char* start = p;
+
+    // 8자리 단위 SWAR 경로 (19자리 한도 내에서만)
+    uint64_t chunk;
+    while (end - p >= 8 && significant + 8 <= 19 && loadEightDigits(p, chunk)) {
+        mantissa = mantissa * 100000000ULL + parseEightDigits(chunk);
+        if (mantissa != 0) significant += 8;
+        p += 8;
+    }
+
+    while (p < end && *p >= '0' && *p <= '9') {
+        const unsigned digit = static_cast<unsigned>(*p - '0');
+        if (significant < 19) {
+            mantissa = mantissa * 10 + digit;
+            if (mantissa != 0) ++significant;
+        } else {
+            significant = 20;   // overflow 표시
+        }
+        ++p;
+    }
+    return static_cast<size_t>(p - start);
+}
+
+/**
+ * @brief 문법 검증이 끝난 JSON 숫자 텍스트를 변환
+ *
+ * - 정수: 19자리 이하는 SWAR 누적 결과 그대로, 넘으면 from_chars
+ * - 실수: mantissa ≤ 2^53, |10진 지수| ≤ 22 이면 정확한 빠른 경로 (Clinger),
+ *         그 외는 from_chars (정확한 반올림)
+ */
+inline bool parseNumber(const char* text, size_t length, ParsedNumber& out) {
+    static const double kPow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* p = text;
+    const char* end = text + length;
+    const bool negative = (p < end && *p == '-');
+    if (negative) ++p;
+
+    uint64_t mantissa = 0;
+    int significant = 0;
+    accumulateDigits(p, end, mantissa, significant);
+
+    bool isInteger = true;
+    int exponent10 = 0;
+
+    if (p < end && *p == '.') {
+        isInteger = false;
+        ++p;
+        const size_t fractionDigits = accumulateDigits(p, end, mantissa, significant);
+        exponent10 -= static_cast<int>(fractionDigits);
+    }
+
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        isInteger = false;
+        ++p;
+        bool expNegative = false;
+        if (p < end && (*p == '+' || *p == '-')) {
+            expNegative = (*p == '-');
+            ++p;
+        }
+        int exp = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (exp < 100000) exp = exp * 10 + (*p - '0');
+            ++p;
+        }
+        exponent10 += expNegative ? -exp : exp;
+    }
+
+    if (isInteger && significant <= 19) {
+        if (!negative) {
+            out.kind = ParsedNumber::Kind::UInt64;
+            out.u = mantissa;
+            return true;
+        }
+        if (mantissa <= 9223372036854775808ULL) {
+            out.kind = ParsedNumber::Kind::Int64;
+            out.i = static_cast<int64_t>(0 - mantissa);
+            return true;
+        }
+    }
+
+    if (isInteger && !negative) {
+        // 20자리 uint64 (예: 18446744073709551615)
+        uint64_t value = 0;
+        const auto result = std::from_chars(text, end, value);
+        if (result.ec == std::errc() && result.ptr == end) {
+            out.kind = ParsedNumber::Kind::UInt64;
+            out.u = value;
+            return true;
+        }
+    }
+
+    out.kind = ParsedNumber::Kind::Double;
+
+    if (significant <= 19 && mantissa <= (1ULL << 53) && exponent10 >= -22 && exponent10 <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = exponent10 < 0 ? value / kPow10[-exponent10] : value * kPow10[exponent10];
+        out.d = negative ? -value : value;
+        return true;
+    }
+
+    const auto result = std::from_chars(text, end, out.d);
+    if (result.ec == std::errc::result_out_of_range) {
+        // 언더플로는 0, 오버플로는 RapidJSON과 같이 오류 (kParseErrorNumberTooBig)
+        if (exponent10 >= 0) return false;
+        out.d = negative ? -0.0 : 0.0;
+        return true;
+    }
+    return result.ec == std::errc();
+}
+
+// ========================================
+// 고정 소수점 10진수 (double 미경유)
+// ========================================
+
+/**
+ * @brief 값 = mantissa / 10^scale
+ */
+struct Decimal {
+    int64_t mantissa = 0;
+    int32_t scale = 0;
+};
+
+// int64로 손실 없이 다룰 수 있는 최대 자릿수/scale
+constexpr int kMaxDecimalDigits = 18;
+
+inline uint64_t decimalPow10(int exponent) {
+    static const uint64_t kPow10[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+        10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL
+    };
+    return kPow10[exponent];
+}
+
+/**
+ * @brief 고정 소수점 표기("-123.45") 텍스트 → Decimal
+ *
+ * 소수점이 있고 지수가 없으며 값이 int64 mantissa, scale ≤ 18로 표현될 때만 성공
+ * (정수와 지수 표기는 document 값으로 정확히 표현되거나 대상이 아님)
+ */
+inline bool parseDecimal(const char* text, size_t length, Decimal& out) {
+    const char* p = text;
+    const char* end = text + length;
+    const bool negative = (p < end && *p == '-');
+    if (negative) ++p;
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int scale = 0;
+    bool seenPoint = false;
+
+    for (; p < end; ++p) {
+        const char c = *p;
+        if (c == '.') {
+            if (seenPoint) return false;
+            seenPoint = true;
+            continue;
+        }
+        if (c < '0' || c > '9') return false;   // 지수 표기 등
+        if (mantissa != 0 || c != '0') ++digits;
+        if (digits > kMaxDecimalDigits + 1) return false;   // 19자리까지 uint64에 안전
+        mantissa = mantissa * 10 + static_cast<unsigned>(c - '0');
+        if (seenPoint) ++scale;
+    }
+    if (!seenPoint || scale > kMaxDecimalDigits) return false;
+    if (mantissa > (negative ? 9223372036854775808ULL : static_cast<uint64_t>(INT64_MAX))) return false;
+
+    out.mantissa = negative ? static_cast<int64_t>(0 - mantissa) : static_cast<int64_t>(mantissa);
+    out.scale = scale;
+    return true;
+}
+
+/**
+ * @brief Decimal → 고정 소수점 텍스트 (scale 자리 그대로, 종료 문자 없음)
+ *
+ * @param out 최소 kDecimalTextCapacity 바이트
+ * @return 기록한 길이
+ */
+constexpr size_t kDecimalTextCapacity = 48;
+
+inline size_t formatDecimal(const Decimal& value, char* out) {
+    char digits[24];
+    size_t count = 0;
+    uint64_t magnitude = value.mantissa < 0 ? 0 - static_cast<uint64_t>(value.mantissa)
+                                            : static_cast<uint64_t>(value.mantissa);
+    do {
+        digits[count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    const size_t scale = static_cast<size_t>(value.scale);
+    // 정수부가 비면 0으로 채움 ("0.005")
+    while (count <= scale) digits[count++] = '0';
+
+    char* p = out;
+    if (value.mantissa < 0) *p++ = '-';
+    for (size_t i = count; i-- > 0;) {
+        *p++ = digits[i];
+        if (i == scale && scale > 0) *p++ = '.';
+    }
+    return static_cast<size_t>(p - out);
+}
+
+/**
+ * @brief scale 변경 (줄일 때는 0에서 먼 쪽으로 반올림)
+ *
+ * @return int64 범위를 넘거나 scale이 0..18 밖이면 false
+ */
+inline bool rescaleDecimal(const Decimal& value, int scale, int64_t& out) {
+    if (scale < 0 || scale > kMaxDecimalDigits) return false;
+
+    if (scale >= value.scale) {
+        const int64_t factor = static_cast<int64_t>(decimalPow10(scale - value.scale));
+        if (value.mantissa > INT64_MAX / factor || value.mantissa < INT64_MIN / factor) return false;
+        out = value.mantissa * factor;
+        return true;
+    }
+
+    const int64_t divisor = static_cast<int64_t>(decimalPow10(value.scale - scale));
+    int64_t quotient = value.mantissa / divisor;
+    const int64_t remainder = value.mantissa % divisor;
+    // |remainder| * 2 >= divisor 이면 반올림 (오버플로 없이 비교)
+    const int64_t absRemainder = remainder < 0 ? -remainder : remainder;
+    if (absRemainder >= divisor - absRemainder) {
+        quotient += value.mantissa < 0 ? -1 : 1;
+    }
+    out = quotient;
+    return true;
+}
+
+// ========================================
+// 정수 → 텍스트 (자릿수 선계산 + 2자리 표)
+// ========================================
+
+// int64/uint64 텍스트 최대 길이 ("-9223372036854775808", "18446744073709551615")
+constexpr size_t kMaxIntegerTextLength = 20;
+
+inline unsigned highestBitIndex(uint64_t value) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#endif
+}
+
+/**
+ * @brief 10진 자릿수 (0은 1자리)
+ *
+ * 비트 길이 × log10(2) ≈ × 1233 / 4096 으로 추정 후 10^n 표와 한 번 비교
+ */
+inline unsigned countDigits(uint64_t value) {
+    static const uint64_t kPow10[] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+        10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
+    // 0은 1과 같은 1자리 (| 1은 10^n 경계를 넘지 않음)
+    const uint64_t nonZero = value | 1;
+    const unsigned estimate = ((highestBitIndex(nonZero) + 1) * 1233) >> 12;
+    return estimate + 1 - static_cast<unsigned>(nonZero < kPow10[estimate]);
+}
+
+/**
+ * @brief 부호 없는 정수를 정확히 digits 자리로 기록 (뒤에서부터 2자리씩)
+ */
+inline void writeDigits(uint64_t value, char* out, unsigned digits) {
+    static const char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    char* p = out + digits;
+    while (value >= 100) {
+        const unsigned pair = static_cast<unsigned>(value % 100) * 2;
+        value /= 100;
+        p -= 2;
+        std::memcpy(p, kDigitPairs + pair, 2);
+    }
+    if (value >= 10) {
+        p -= 2;
+        std::memcpy(p, kDigitPairs + value * 2, 2);
+    } else {
+        *--p = static_cast<char>('0' + value);
+    }
+}
+
+/**
+ * @brief 정수 → 텍스트 (종료 문자 없음)
+ *
+ * @param out 최소 kMaxIntegerTextLength 바이트
+ * @return 기록한 길이
+ */
+inline size_t formatUint64(uint64_t value, char* out) {
+    const unsigned digits = countDigits(value);
+    writeDigits(value, out, digits);
+    return digits;
+}
+
+inline size_t formatInt64(int64_t value, char* out) {
+    const bool negative = value < 0;
+    const uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+    *out = '-';
+    return formatUint64(magnitude, out + negative) + negative;
+}
+
+// 키 → 루트 멤버의 정확한 10진수 값 (document에는 double 근사값)
+using DecimalMap = std::map<std::string, Decimal, std::less<>>;
+
+} // namespace detail
+} // namespace json
@@ -0,0 +1,421 @@
+#pragma once
+
+/**
+ * JsonablePacked.hpp - 숫자 배열 packed 저장소 및 파싱 경로 (완전 inline)
+ *
+ * 역할: 루트 객체의 숫자 전용 배열을 요소별 DOM 노드 없이
+ *       연속 버퍼(int64 / double / uint32)로 보관
+ */
+
+#include <string>
+#include <vector>
+#include <map>
+#include <variant>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+
+#include "JsonableNumber.hpp"
+
+namespace json {
+namespace detail {
+
+/**
+ * @brief 연속 버퍼에 저장된 숫자 배열 (packed typed-array 노드)
+ *
+ * document에는 같은 키의 빈 배열이 자리표시자로 남아 키 순서와
+ * hasKey()/isArray() 결과를 유지하고, 실제 요소는 이 버퍼에 있음
+ *
+ * 요소당 메모리: double/int64 8바이트, uint32 4바이트 (DOM Value는 16바이트)
+ */
+struct PackedArray {
+    std::variant<std::vector<int64_t>, std::vector<double>, std::vector<uint32_t>> values;
+
+    // 이보다 짧은 배열은 DOM 노드 비용이 작아 그대로 둠
+    static constexpr size_t kMinElements = 16;
+
+    /**
+     * @brief setArray<T>가 packed 저장소를 사용할 수 있는 요소 타입
+     */
+    template<typename T>
+    static constexpr bool isPackable = std::disjunction_v<
+        std::is_same<T, int>,
+        std::is_same<T, int64_t>,
+        std::is_same<T, double>,
+        std::is_same<T, float>,
+        std::is_same<T, uint32_t>,
+        std::is_same<T, uint64_t>
+    >;
+
+    /**
+     * @brief 연속 요소 범위(vector, std::array 등)로부터 packed 배열 생성
+     *
+     * @return 정밀도/표기를 보존할 수 없으면 false (uint64 > INT64_MAX 등)
+     */
+    template<typename Range>
+    static inline bool from(const Range& source, PackedArray& out) {
+        using T = typename Range::value_type;
+        static_assert(isPackable<T>, "T must be a packable numeric type");
+
+        if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+            out.values = std::vector<double>(std::begin(source), std::end(source));
+        } else if constexpr (std::is_same_v<T, int64_t> || std::is_same_v<T, int>) {
+            out.values = std::vector<int64_t>(std::begin(source), std::end(source));
+        } else if constexpr (std::is_same_v<T, uint32_t>) {
+            out.values = std::vector<uint32_t>(std::begin(source), std::end(source));
+        } else {
+            for (uint64_t v : source) {
+                if (v > static_cast<uint64_t>(INT64_MAX)) return false;
+            }
+            out.values = std::vector<int64_t>(std::begin(source), std::end(source));
+        }
+        return true;
+    }
+
+    inline size_t size() const {
+        return std::visit([](const auto& v) { return v.size(); }, values);
+    }
+
+    /**
+     * @brief 버퍼가 차지하는 바이트 수
+     */
+    inline size_t byteSize() const {
+        return std::visit([](const auto& v) { return v.size() * sizeof(v[0]); }, values);
+    }
+
+    /**
+     * @brief 요소 타입 T로 변환하여 반환 (같은 타입이면 memcpy 복사)
+     */
+    template<typename T>
+    inline std::vector<T> as() const {
+        return std::visit([](const auto& v) -> std::vector<T> {
+            using Stored = typename std::decay_t<decltype(v)>::value_type;
+            if constexpr (std::is_same_v<Stored, T>) {
+                return v;
+            } else if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+                return std::vector<T>(v.begin(), v.end());
+            } else {
+                // 숫자가 아닌 요소 타입: convertFromValue와 같이 기본값
+                return std::vector<T>(v.size());
+            }
+        }, values);
+    }
+
+    /**
+     * @brief 요소 타입 T로 변환하여 out[0..size()) 에 기록 (할당 없음)
+     */
+    template<typename T>
+    inline void copyTo(T* out) const {
+        std::visit([out](const auto& v) {
+            using Stored = typename std::decay_t<decltype(v)>::value_type;
+            if constexpr (std::is_same_v<Stored, T> || (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)) {
+                std::copy(v.begin(), v.end(), out);
+            } else {
+                std::fill(out, out + v.size(), T{});
+            }
+        }, values);
+    }
+
+    /**
+     * @brief 정수 버퍼를 가능한 가장 좁은 타입으로 축소 (모두 0..UINT32_MAX면 uint32)
+     */
+    inline void narrow() {
+        auto* ints = std::get_if<std::vector<int64_t>>(&values);
+        if (!ints) return;
+        for (int64_t v : *ints) {
+            if (v < 0 || v > static_cast<int64_t>(UINT32_MAX)) return;
+        }
+        values = std::vector<uint32_t>(ints->begin(), ints->end());
+    }
+
+    /**
+     * @brief Writer로 배열 출력 (DOM 배열을 Accept한 것과 동일한 결과)
+     */
+    template<typename Writer>
+    inline bool write(Writer& writer) const {
+        if (!writer.StartArray()) return false;
+        if (const auto* ints = std::get_if<std::vector<int64_t>>(&values)) {
+            for (int64_t v : *ints) {
+                if (!writer.Int64(v)) return false;
+            }
+        } else if (const auto* uints = std::get_if<std::vector<uint32_t>>(&values)) {
+            for (uint32_t v : *uints) {
+                if (!writer.Uint(v)) return false;
+            }
+        } else {
+            for (double v : std::get<std::vector<double>>(values)) {
+                if (!writer.Double(v)) return false;
+            }
+        }
+        return writer.EndArray(static_cast<rapidjson::SizeType>(size()));
+    }
+};
+
+// 키 → packed 배열 (const char* 키로 할당 없이 조회)
+using PackedArrayMap = std::map<std::string, PackedArray, std::less<>>;
+
+/**
+ * @brief 숫자 배열을 가로채는 SAX 핸들러 (document 핸들러로 전달)
+ *
+ * - kParseNumbersAsStringsFlag로 숫자 텍스트를 받아 SWAR 커널로 직접 변환
+ * - 루트 객체 멤버 배열이 동종 숫자만 담고 있으면 요소를 연속 버퍼에 누적
+ *   (정수 배열은 값 범위에 따라 uint32로 축소)
+ * - 숫자가 아닌 요소나 중첩 컨테이너가 나오면 누적분을 document로 흘려보내고 일반 경로로 복귀
+ * - decimals가 주어지면(preserveParsedDecimals 모드) 루트 멤버의 고정 소수점 숫자 원문을 Decimal로 함께 보관
+ */
+class PackingHandler {
+public:
+    PackingHandler(rapidjson::Document& document, PackedArrayMap& packed, DecimalMap* decimals = nullptr)
+        : document_(document), packed_(packed), decimals_(decimals) {}
+
+    bool Null() { abortPacking(); return document_.Null(); }
+    bool Bool(bool b) { abortPacking(); return document_.Bool(b); }
+    bool Int(int i) { return Int64(i); }
+    bool Uint(unsigned u) { return Uint64(u); }
+    bool Int64(int64_t i) { return number(ParsedNumber{ParsedNumber::Kind::Int64, i, 0, 0.0}); }
+    bool Uint64(uint64_t u) { return number(ParsedNumber{ParsedNumber::Kind::UInt64, 0, u, 0.0}); }
+    bool Double(double d) { return number(ParsedNumber{ParsedNumber::Kind::Double, 0, 0, d}); }
+
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool) {
+        ParsedNumber parsed;
+        if (!parseNumber(str, length, parsed)) return false;
+        if (decimals_ && depth_ == 1 && rootIsObject_ && parsed.kind == ParsedNumber::Kind::Double) {
+            Decimal decimal;
+            if (parseDecimal(str, length, decimal)) (*decimals_)[currentKey_] = decimal;
+        }
+        return number(parsed);
+    }
+
+    bool String(const char* str, rapidjson::SizeType length, bool copy) {
+        abortPacking();
+        return document_.String(str, length, copy);
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+        if (depth_ == 1) currentKey_.assign(str, length);
+        return document_.Key(str, length, copy);
+    }
+
+    bool StartObject() {
+        abortPacking();
+        if (depth_ == 0) rootIsObject_ = true;
+        ++depth_;
+        return document_.StartObject();
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount) {
+        --depth_;
+        return document_.EndObject(memberCount);
+    }
+
+    bool StartArray() {
+        abortPacking();
+        ++depth_;
+        if (depth_ == 2 && rootIsObject_) {
+            // 루트 멤버 배열: StartArray 전달을 미루고 누적 시작
+            packing_ = true;
+            ints_.clear();
+            doubles_.clear();
+            isDouble_ = false;
+            return true;
+        }
+        return document_.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount) {
+        --depth_;
+        if (!packing_) return document_.EndArray(elementCount);
+
+        packing_ = false;
+        const size_t count = isDouble_ ? doubles_.size() : ints_.size();
+        if (count < PackedArray::kMinElements) {
+            if (!flushBuffered()) return false;
+            return document_.EndArray(elementCount);
+        }
+
+        // document에는 빈 배열 자리표시자만 남김
+        if (!document_.StartArray() || !document_.EndArray(0)) return false;
+        auto& slot = packed_[currentKey_];
+        if (isDouble_) {
+            slot.values = std::move(doubles_);
+        } else {
+            slot.values = std::move(ints_);
+            slot.narrow();
+        }
+        ints_ = std::vector<int64_t>();
+        doubles_ = std::vector<double>();
+        return true;
+    }
+
+private:
+    inline bool number(const ParsedNumber& n) {
+        if (packing_ && append(n)) return true;
+        abortPacking();
+        return emitNumber(n);
+    }
+
+    // RapidJSON Reader와 같은 분류로 document에 숫자 전달
+    inline bool emitNumber(const ParsedNumber& n) {
+        switch (n.kind) {
+        case ParsedNumber::Kind::Int64:
+            if (n.i < 0) {
+                return (n.i >= INT32_MIN) ? document_.Int(static_cast<int>(n.i)) : document_.Int64(n.i);
+            }
+            return (n.i <= static_cast<int64_t>(UINT32_MAX)) ? document_.Uint(static_cast<unsigned>(n.i))
+                                                             : document_.Uint64(static_cast<uint64_t>(n.i));
+        case ParsedNumber::Kind::UInt64:
+            return (n.u <= UINT32_MAX) ? document_.Uint(static_cast<unsigned>(n.u)) : document_.Uint64(n.u);
+        default:
+            return document_.Double(n.d);
+        }
+    }
+
+    // 누적 버퍼에 추가 (동종 배열이 아니게 되면 false → 일반 경로)
+    inline bool append(const ParsedNumber& n) {
+        const bool isDouble = (n.kind == ParsedNumber::Kind::Double);
+        if (ints_.empty() && doubles_.empty()) {
+            isDouble_ = isDouble;
+        } else if (isDouble != isDouble_) {
+            // 정수/실수 혼합: 원래 표기(1 vs 1.0)를 보존하기 위해 packed 하지 않음
+            return false;
+        }
+
+        if (isDouble) {
+            doubles_.push_back(n.d);
+        } else if (n.kind == ParsedNumber::Kind::Int64) {
+            ints_.push_back(n.i);
+        } else if (n.u <= static_cast<uint64_t>(INT64_MAX)) {
+            ints_.push_back(static_cast<int64_t>(n.u));
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    // 미뤄둔 StartArray와 누적 요소를 document로 전달
+    inline bool flushBuffered() {
+        if (!document_.StartArray()) return false;
+        for (double v : doubles_) {
+            if (!document_.Double(v)) return false;
+        }
+        for (int64_t v : ints_) {
+            if (!emitNumber(ParsedNumber{ParsedNumber::Kind::Int64, v, 0, 0.0})) return false;
+        }
+        return true;
+    }
+
+    inline void abortPacking() {
+        if (packing_) {
+            packing_ = false;
+            flushBuffered();
+        }
+    }
+
+    rapidjson::Document& document_;
+    PackedArrayMap& packed_;
+    DecimalMap* decimals_;
+    std::string currentKey_;
+    int depth_ = 0;
+    bool rootIsObject_ = false;
+
+    bool packing_ = false;
+    bool isDouble_ = false;
+    std::vector<int64_t> ints_;
+    std::vector<double> doubles_;
+};
+
+/**
+ * @brief SAX 이벤트 생성기로 document 구성 (숫자 배열은 packed 경로)
+ *
+ * accept(handler)는 PackingHandler에 JSON 이벤트를 순서대로 전달하고 성공 여부 반환
+ * 성공 시에만 packed/decimal 맵을 교체함 (실패 시 기존 내용 유지)
+ */
+template<typename Accept>
+inline bool populateWithPacking(rapidjson::Document& document, Accept&& accept, PackedArrayMap& packed,
+                                DecimalMap* decimals) {
+    PackedArrayMap parsed;
+    DecimalMap parsedDecimals;
+    bool ok = false;
+
+    auto generator = [&](rapidjson::Document& target) {
+        PackingHandler handler(target, parsed, decimals ? &parsedDecimals : nullptr);
+        ok = accept(handler);
+        return ok;
+    };
+    document.Populate(generator);
+
+    if (ok) {
+        packed.swap(parsed);
+        if (decimals) decimals->swap(parsedDecimals);
+    }
+    return ok;
+}
+
+/**
+ * @brief 숫자 배열 packed 경로로 JSON 파싱
+ */
+template<unsigned extraFlags, typename InputStream>
+inline bool parseStreamWithPacking(rapidjson::Document& document, InputStream& stream, PackedArrayMap& packed,
+                                   DecimalMap* decimals) {
+    return populateWithPacking(document, [&stream](PackingHandler& handler) {
+        rapidjson::Reader reader;
+        return !reader.Parse<rapidjson::kParseNumbersAsStringsFlag | extraFlags>(stream, handler).IsError();
+    }, packed, decimals);
+}
+
+inline bool parseWithPacking(rapidjson::Document& document, const char* json, PackedArrayMap& packed,
+                             DecimalMap* decimals = nullptr) {
+    rapidjson::StringStream stream(json);
+    return parseStreamWithPacking<rapidjson::kParseNoFlags>(document, stream, packed, decimals);
+}
+
+/**
+ * @brief '\0' 종료가 없는 바이트 범위 입력 스트림 (RapidJSON InputStream 개념)
+ *
+ * 범위 끝에서는 '\0' (큰 버퍼 안의 레코드 하나를 복사 없이 파싱)
+ */
+class RangeStream {
+public:
+    typedef char Ch;
+
+    RangeStream(const char* begin, size_t length) : begin_(begin), current_(begin), end_(begin + length) {}
+
+    inline Ch Peek() const { return current_ < end_ ? *current_ : '\0'; }
+    inline Ch Take() { return current_ < end_ ? *current_++ : '\0'; }
+    inline size_t Tell() const { return static_cast<size_t>(current_ - begin_); }
+
+    // 출력 관련 멤버는 Reader가 호출하지 않음
+    Ch* PutBegin() { return nullptr; }
+    void Put(Ch) {}
+    void Flush() {}
+    size_t PutEnd(Ch*) { return 0; }
+
+private:
+    const char* begin_;
+    const char* current_;
+    const char* end_;
+};
+
+inline bool parseRangeWithPacking(rapidjson::Document& document, const char* json, size_t length,
+                                  PackedArrayMap& packed, DecimalMap* decimals = nullptr) {
+    RangeStream stream(json, length);
+    return parseStreamWithPacking<rapidjson::kParseNoFlags>(document, stream, packed, decimals);
+}
+
+/**
+ * @brief 제자리(in-situ) 파싱: json 버퍼를 디코딩 결과로 덮어쓰고
+ *        document 문자열이 버퍼를 직접 참조 (버퍼는 '\0' 종료, document보다 오래 유지)
+ */
+inline bool parseInsituWithPacking(rapidjson::Document& document, char* json, PackedArrayMap& packed,
+                                   DecimalMap* decimals = nullptr) {
+    rapidjson::InsituStringStream stream(json);
+    return parseStreamWithPacking<rapidjson::kParseInsituFlag>(document, stream, packed, decimals);
+}
+
+} // namespace detail
+} // namespace json
@@ -0,0 +1,885 @@
+#pragma once
+
+/**
+ * JsonablePersistent.hpp - 구조 공유 불변 document (완전 inline)
+ *
+ * 역할: 값 트리를 불변 노드(shared_ptr<const>)로 보관하여
+ *       수정 시 루트부터 수정 위치까지의 경로만 새로 만들고
+ *       나머지 하위 트리는 이전 버전과 공유 (path copying)
+ *       - 버전 복사: 포인터 하나 (O(1))
+ *       - 필드 수정: 경로상 컨테이너마다 32갈래 트라이 경로(log32 자식 수 노드, 노드당 최대 32칸)만 새로 만듦
+ *                    큰 객체의 키 조회는 HAMT 색인, 멤버 키 문자열은 버전 간 공유
+ *       - 메모리: 버전 간 바뀐 경로만 추가
+ *
+ * 경로는 JSON Pointer (RFC 6901): "/users/0/name", "~0" = '~', "~1" = '/'
+ */
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <variant>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "JsonableWriter.hpp"
+#include "ToJsonable.hpp"
+#include "FromJsonable.hpp"
+
+namespace json {
+namespace detail {
+
+inline unsigned bitCount(uint32_t mask) {
+#if defined(_MSC_VER)
+    return static_cast<unsigned>(__popcnt(mask));
+#else
+    return static_cast<unsigned>(__builtin_popcount(mask));
+#endif
+}
+
+// ========================================
+// 32갈래 불변 벡터 (배열 요소 / 객체 멤버 목록)
+// ========================================
+
+/**
+ * @brief 32칸 노드 트라이로 나눈 불변 벡터 (왼쪽부터 꽉 채움)
+ *
+ * 원소 교체/끝 추가는 루트에서 잎까지의 노드(log32 n개, 각 최대 32칸)만 복사하고 나머지 노드는 공유
+ * 32개 이하면 잎 노드 하나 (평탄한 배열과 같은 비용)
+ * 중간 삭제는 전체 재구성 (O(n))
+ */
+template<typename T>
+class PersistentVector {
+public:
+    PersistentVector() = default;
+
+    // 한 번에 구성 (잎을 채운 뒤 위로 묶음, 복사 없음)
+    explicit PersistentVector(std::vector<T> items) : size_(items.size()) {
+        if (items.empty()) return;
+        std::vector<NodePtr> level;
+        level.reserve((items.size() + kMask) / kWidth);
+        if (items.size() <= kWidth) {
+            auto leaf = std::make_shared<Node>();
+            leaf->items = std::move(items);
+            level.push_back(std::move(leaf));
+        } else {
+            for (size_t begin = 0; begin < items.size(); begin += kWidth) {
+                auto leaf = std::make_shared<Node>();
+                const size_t end = std::min(items.size(), begin + kWidth);
+                leaf->items.reserve(end - begin);
+                for (size_t i = begin; i < end; ++i) leaf->items.push_back(std::move(items[i]));
+                level.push_back(std::move(leaf));
+            }
+        }
+        while (level.size() > 1) {
+            std::vector<NodePtr> parents;
+            parents.reserve((level.size() + kMask) / kWidth);
+            for (size_t begin = 0; begin < level.size(); begin += kWidth) {
+                auto parent = std::make_shared<Node>();
+                const size_t end = std::min(level.size(), begin + kWidth);
+                parent->children.assign(std::make_move_iterator(level.begin() + static_cast<std::ptrdiff_t>(begin)),
+                                        std::make_move_iterator(level.begin() + static_cast<std::ptrdiff_t>(end)));
+                parents.push_back(std::move(parent));
+            }
+            level.swap(parents);
+            shift_ += kBits;
+        }
+        root_ = std::move(level.front());
+    }
+
+    inline size_t size() const { return size_; }
+    inline bool empty() const { return size_ == 0; }
+
+    inline const T& operator[](size_t index) const {
+        const Node* node = root_.get();
+        for (unsigned shift = shift_; shift > 0; shift -= kBits) {
+            node = node->children[(index >> shift) & kMask].get();
+        }
+        return node->items[index & kMask];
+    }
+
+    inline PersistentVector set(size_t index, T value) const {
+        PersistentVector result = *this;
+        result.root_ = setIn(*root_, shift_, index, std::move(value));
+        return result;
+    }
+
+    inline PersistentVector pushBack(T value) const {
+        PersistentVector result = *this;
+        if (!root_) {
+            result.root_ = newPath(0, std::move(value));
+        } else if (size_ == (kWidth << shift_)) {
+            // 루트가 가득 참 → 한 단계 높은 루트
+            auto root = std::make_shared<Node>();
+            root->children.push_back(root_);
+            root->children.push_back(newPath(shift_, std::move(value)));
+            result.root_ = std::move(root);
+            result.shift_ = shift_ + kBits;
+        } else {
+            result.root_ = pushIn(*root_, shift_, size_, std::move(value));
+        }
+        ++result.size_;
+        return result;
+    }
+
+    // 순서대로 방문 (visit이 false를 반환하면 중단)
+    template<typename Visit>
+    inline bool forEach(Visit&& visit) const {
+        return !root_ || visitNode(*root_, shift_, visit);
+    }
+
+    inline std::vector<T> toVector() const {
+        std::vector<T> items;
+        items.reserve(size_);
+        forEach([&items](const T& item) {
+            items.push_back(item);
+            return true;
+        });
+        return items;
+    }
+
+private:
+    static constexpr unsigned kBits = 5;
+    static constexpr size_t kWidth = size_t(1) << kBits;
+    static constexpr size_t kMask = kWidth - 1;
+
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+    struct Node {
+        std::vector<T> items;          // 잎
+        std::vector<NodePtr> children; // 내부 노드
+    };
+
+    static inline NodePtr newPath(unsigned shift, T&& value) {
+        auto node = std::make_shared<Node>();
+        if (shift == 0) node->items.push_back(std::move(value));
+        else node->children.push_back(newPath(shift - kBits, std::move(value)));
+        return node;
+    }
+
+    static inline NodePtr setIn(const Node& node, unsigned shift, size_t index, T&& value) {
+        auto copy = std::make_shared<Node>(node);
+        if (shift == 0) {
+            copy->items[index & kMask] = std::move(value);
+        } else {
+            const size_t slot = (index >> shift) & kMask;
+            copy->children[slot] = setIn(*node.children[slot], shift - kBits, index, std::move(value));
+        }
+        return copy;
+    }
+
+    static inline NodePtr pushIn(const Node& node, unsigned shift, size_t index, T&& value) {
+        auto copy = std::make_shared<Node>(node);
+        if (shift == 0) {
+            copy->items.push_back(std::move(value));
+        } else {
+            const size_t slot = (index >> shift) & kMask;
+            if (slot < copy->children.size()) {
+                copy->children[slot] = pushIn(*node.children[slot], shift - kBits, index, std::move(value));
+            } else {
+                copy->children.push_back(newPath(shift - kBits, std::move(value)));
+            }
+        }
+        return copy;
+    }
+
+    template<typename Visit>
+    static inline bool visitNode(const Node& node, unsigned shift, Visit& visit) {
+        if (shift == 0) {
+            for (const T& item : node.items) {
+                if (!visit(item)) return false;
+            }
+            return true;
+        }
+        for (const NodePtr& child : node.children) {
+            if (!visitNode(*child, shift - kBits, visit)) return false;
+        }
+        return true;
+    }
+
+    NodePtr root_;
+    size_t size_ = 0;
+    unsigned shift_ = 0;   // 루트 높이 * kBits (잎 루트는 0)
+};
+
+struct PersistentNode;
+using PersistentNodePtr = std::shared_ptr<const PersistentNode>;
+using PersistentArray = PersistentVector<PersistentNodePtr>;
+using PersistentKey = std::shared_ptr<const std::string>;   // 경로 복사 시 키 문자열 재할당 방지
+using PersistentMember = std::pair<PersistentKey, PersistentNodePtr>;
+
+// ========================================
+// 키 → 멤버 위치 HAMT (큰 객체 전용)
+// ========================================
+
+/**
+ * @brief 해시 5비트씩 32갈래로 나누는 불변 해시 트라이 (hash array mapped trie)
+ *
+ * 노드는 비트맵 + 실제로 쓰는 칸만 보관, 갱신은 루트부터 해당 칸까지의 노드만 복사
+ * 해시 비트를 모두 쓴 깊이에서는 충돌 목록을 선형 비교
+ */
+class PersistentKeyIndex {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    inline bool empty() const { return !root_; }
+
+    inline size_t find(const std::string& key) const {
+        const size_t hash = std::hash<std::string>()(key);
+        const Node* node = root_.get();
+        for (unsigned shift = 0; node; shift += kBits) {
+            if (shift >= kHashBits) {
+                for (const Entry& entry : node->collisions) {
+                    if (*entry.key == key) return entry.slot;
+                }
+                return npos;
+            }
+            const uint32_t bit = uint32_t(1) << ((hash >> shift) & kMask);
+            if (!(node->bitmap & bit)) return npos;
+            const Slot& slot = node->slots[bitCount(node->bitmap & (bit - 1))];
+            if (!slot.child) {
+                return slot.entry.hash == hash && *slot.entry.key == key ? slot.entry.slot : npos;
+            }
+            node = slot.child.get();
+        }
+        return npos;
+    }
+
+    // key의 위치를 slot으로 설정한 새 색인 (없으면 추가)
+    inline PersistentKeyIndex assign(const PersistentKey& key, size_t slot) const {
+        auto root = root_ ? std::make_shared<Node>(*root_) : std::make_shared<Node>();
+        insert<false>(*root, 0, Entry{std::hash<std::string>()(*key), key, slot});
+        PersistentKeyIndex result;
+        result.root_ = std::move(root);
+        return result;
+    }
+
+    // 살아 있는 멤버 전체로 구성 (같은 키가 여럿이면 앞의 멤버)
+    static inline PersistentKeyIndex build(const std::vector<PersistentMember>& members) {
+        auto root = std::make_shared<Node>();
+        for (size_t slot = members.size(); slot-- > 0;) {
+            if (!members[slot].second) continue;
+            const PersistentKey& key = members[slot].first;
+            insert<true>(*root, 0, Entry{std::hash<std::string>()(*key), key, slot});
+        }
+        PersistentKeyIndex result;
+        result.root_ = std::move(root);
+        return result;
+    }
+
+private:
+    static constexpr unsigned kBits = 5;
+    static constexpr size_t kMask = 31;
+    static constexpr unsigned kHashBits = sizeof(size_t) * 8;
+
+    struct Node;
+    struct Entry {
+        size_t hash = 0;
+        PersistentKey key;
+        size_t slot = 0;
+    };
+    struct Slot {
+        std::shared_ptr<Node> child;   // 있으면 하위 노드, 없으면 entry
+        Entry entry;
+    };
+    // 게시된 색인에서 닿는 노드는 수정하지 않음 (수정은 새로 만든 사본에만)
+    struct Node {
+        uint32_t bitmap = 0;
+        std::vector<Slot> slots;
+        std::vector<Entry> collisions;   // shift >= kHashBits 깊이 전용
+    };
+
+    // Owned: node 아래 하위 노드도 이번 구성에서 만든 것이라 제자리 수정 가능
+    template<bool Owned>
+    static inline void insert(Node& node, unsigned shift, Entry entry) {
+        if (shift >= kHashBits) {
+            for (Entry& existing : node.collisions) {
+                if (*existing.key == *entry.key) {
+                    existing.slot = entry.slot;
+                    return;
+                }
+            }
+            node.collisions.push_back(std::move(entry));
+            return;
+        }
+        const uint32_t bit = uint32_t(1) << ((entry.hash >> shift) & kMask);
+        const auto position = node.slots.begin() + bitCount(node.bitmap & (bit - 1));
+        if (!(node.bitmap & bit)) {
+            node.bitmap |= bit;
+            node.slots.insert(position, Slot{nullptr, std::move(entry)});
+            return;
+        }
+        Slot& slot = *position;
+        if (slot.child) {
+            if constexpr (!Owned) slot.child = std::make_shared<Node>(*slot.child);
+            insert<Owned>(*slot.child, shift + kBits, std::move(entry));
+        } else if (slot.entry.hash == entry.hash && *slot.entry.key == *entry.key) {
+            slot.entry.slot = entry.slot;
+        } else {
+            // 같은 칸의 두 키를 한 단계 아래 새 노드로 분리
+            auto child = std::make_shared<Node>();
+            insert<true>(*child, shift + kBits, std::move(slot.entry));
+            insert<true>(*child, shift + kBits, std::move(entry));
+            slot.child = std::move(child);
+            slot.entry = Entry();
+        }
+    }
+
+    std::shared_ptr<const Node> root_;
+};
+
+// ========================================
+// 객체 멤버 목록
+// ========================================
+
+/**
+ * @brief 삽입 순서 멤버 목록 + 큰 객체의 키 색인
+ *
+ * - kIndexThreshold 이하: 선형 조회, 삭제는 목록 재구성 (잎 하나 복사와 같은 비용)
+ * - 초과: HAMT로 조회, 삭제는 자리만 비움 (child == nullptr), 빈 자리가 살아 있는 멤버보다 많으면 압축
+ */
+struct PersistentObject {
+    static constexpr size_t kIndexThreshold = 32;
+    static constexpr size_t npos = PersistentKeyIndex::npos;
+
+    PersistentVector<PersistentMember> members;
+    PersistentKeyIndex index;
+    size_t count = 0;   // 살아 있는 멤버 수
+
+    static inline PersistentObject build(std::vector<PersistentMember> items) {
+        PersistentObject object;
+        for (const auto& member : items) {
+            if (member.second) ++object.count;
+        }
+        if (items.size() > kIndexThreshold) object.index = PersistentKeyIndex::build(items);
+        object.members = PersistentVector<PersistentMember>(std::move(items));
+        return object;
+    }
+
+    inline size_t find(const std::string& key) const {
+        if (!index.empty()) {
+            const size_t slot = index.find(key);
+            return slot != npos && members[slot].second ? slot : npos;
+        }
+        for (size_t slot = 0; slot < members.size(); ++slot) {
+            const PersistentMember& member = members[slot];
+            if (member.second && *member.first == key) return slot;
+        }
+        return npos;
+    }
+
+    inline PersistentObject withChild(size_t slot, PersistentNodePtr child) const {
+        PersistentObject result = *this;
+        result.members = members.set(slot, PersistentMember(members[slot].first, std::move(child)));
+        return result;
+    }
+
+    inline PersistentObject withMember(PersistentKey key, PersistentNodePtr child) const {
+        PersistentObject result = *this;
+        const size_t slot = members.size();
+        result.members = members.pushBack(PersistentMember(key, std::move(child)));
+        ++result.count;
+        if (!index.empty()) {
+            result.index = index.assign(key, slot);
+        } else if (result.members.size() > kIndexThreshold) {
+            result.index = PersistentKeyIndex::build(result.members.toVector());
+        }
+        return result;
+    }
+
+    inline PersistentObject without(size_t slot) const {
+        if (index.empty()) {
+            std::vector<PersistentMember> items = members.toVector();
+            items.erase(items.begin() + static_cast<std::ptrdiff_t>(slot));
+            return build(std::move(items));
+        }
+        PersistentObject result = withChild(slot, nullptr);
+        --result.count;
+        if (result.members.size() - result.count > result.count) {
+            std::vector<PersistentMember> live;
+            live.reserve(result.count);
+            result.members.forEach([&live](const PersistentMember& member) {
+                if (member.second) live.push_back(member);
+                return true;
+            });
+            return build(std::move(live));
+        }
+        return result;
+    }
+
+    // 살아 있는 멤버를 삽입 순서로 방문
+    template<typename Visit>
+    inline bool forEach(Visit&& visit) const {
+        return members.forEach([&visit](const PersistentMember& member) {
+            return !member.second || visit(member);
+        });
+    }
+};
+
+/**
+ * @brief 불변 값 노드 (생성 후 변경 없음 → 여러 버전이 안전하게 공유)
+ *
+ * 정수는 int64 범위면 int64_t, 넘는 양수만 uint64_t
+ */
+struct PersistentNode {
+    std::variant<std::monostate, bool, int64_t, uint64_t, double, std::string, PersistentArray, PersistentObject> value;
+};
+
+template<typename V>
+inline PersistentNodePtr makePersistentNode(V&& value) {
+    auto node = std::make_shared<PersistentNode>();
+    node->value = std::forward<V>(value);
+    return node;
+}
+
+/**
+ * @brief JSON Pointer를 참조 토큰으로 분해 ("" = 루트)
+ */
+inline bool splitPointer(const std::string& pointer, std::vector<std::string>& tokens) {
+    tokens.clear();
+    if (pointer.empty()) return true;
+    if (pointer[0] != '/') return false;
+    std::string token;
+    for (size_t i = 1; i <= pointer.size(); ++i) {
+        if (i == pointer.size() || pointer[i] == '/') {
+            tokens.push_back(std::move(token));
+            token.clear();
+        } else if (pointer[i] == '~') {
+            if (i + 1 >= pointer.size() || (pointer[i + 1] != '0' && pointer[i + 1] != '1')) return false;
+            token += pointer[++i] == '0' ? '~' : '/';
+        } else {
+            token += pointer[i];
+        }
+    }
+    return true;
+}
+
+// 배열 인덱스 토큰 ("-"는 끝 다음 위치)
+inline bool parseArrayIndex(const std::string& token, size_t size, size_t& index) {
+    if (token == "-") {
+        index = size;
+        return true;
+    }
+    if (token.empty() || token.size() > 19 || (token.size() > 1 && token[0] == '0')) return false;
+    index = 0;
+    for (char c : token) {
+        if (c < '0' || c > '9') return false;
+        index = index * 10 + static_cast<size_t>(c - '0');
+    }
+    return true;
+}
+
+inline const PersistentNodePtr* findMember(const PersistentObject& object, const std::string& key) {
+    const size_t slot = object.find(key);
+    return slot != PersistentObject::npos ? &object.members[slot].second : nullptr;
+}
+
+/**
+ * @brief SAX 이벤트로 노드 트리를 바로 구성 (중간 DOM 없음)
+ */
+class PersistentBuilder {
+public:
+    bool Null() { return add(makePersistentNode(std::monostate())); }
+    bool Bool(bool b) { return add(makePersistentNode(b)); }
+    bool Int(int i) { return add(makePersistentNode(static_cast<int64_t>(i))); }
+    bool Uint(unsigned u) { return add(makePersistentNode(static_cast<int64_t>(u))); }
+    bool Int64(int64_t i) { return add(makePersistentNode(i)); }
+    bool Uint64(uint64_t u) {
+        return u <= static_cast<uint64_t>(INT64_MAX) ? add(makePersistentNode(static_cast<int64_t>(u)))
+                                                      : add(makePersistentNode(u));
+    }
+    bool Double(double d) { return add(makePersistentNode(d)); }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return false; }
+    bool String(const char* str, rapidjson::SizeType length, bool) {
+        return add(makePersistentNode(std::string(str, length)));
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool) {
+        frames_.back().key.assign(str, length);
+        return true;
+    }
+
+    bool StartObject() {
+        frames_.push_back(Frame{false, {}, {}, {}});
+        return true;
+    }
+    bool StartArray() {
+        frames_.push_back(Frame{true, {}, {}, {}});
+        return true;
+    }
+    bool EndObject(rapidjson::SizeType) {
+        std::vector<PersistentMember> members = std::move(frames_.back().members);
+        frames_.pop_back();
+        return add(makePersistentNode(PersistentObject::build(std::move(members))));
+    }
+    bool EndArray(rapidjson::SizeType) {
+        std::vector<PersistentNodePtr> items = std::move(frames_.back().items);
+        frames_.pop_back();
+        return add(makePersistentNode(PersistentArray(std::move(items))));
+    }
+
+    PersistentNodePtr root;
+
+private:
+    struct Frame {
+        bool isArray;
+        std::string key;
+        std::vector<PersistentNodePtr> items;
+        std::vector<PersistentMember> members;
+    };
+
+    inline bool add(PersistentNodePtr node) {
+        if (frames_.empty()) {
+            root = std::move(node);
+        } else if (frames_.back().isArray) {
+            frames_.back().items.push_back(std::move(node));
+        } else {
+            frames_.back().members.emplace_back(std::make_shared<const std::string>(std::move(frames_.back().key)),
+                                                std::move(node));
+        }
+        return true;
+    }
+
+    std::vector<Frame> frames_;
+};
+
+template<typename Handler>
+inline bool acceptPersistent(const PersistentNode& node, Handler& handler) {
+    switch (node.value.index()) {
+        case 0: return handler.Null();
+        case 1: return handler.Bool(std::get<bool>(node.value));
+        case 2: return handler.Int64(std::get<int64_t>(node.value));
+        case 3: return handler.Uint64(std::get<uint64_t>(node.value));
+        case 4: return handler.Double(std::get<double>(node.value));
+        case 5: {
+            const std::string& str = std::get<std::string>(node.value);
+            return handler.String(str.data(), static_cast<rapidjson::SizeType>(str.size()), true);
+        }
+        case 6: {
+            const auto& items = std::get<PersistentArray>(node.value);
+            if (!handler.StartArray()) return false;
+            const bool ok = items.forEach([&handler](const PersistentNodePtr& item) {
+                return acceptPersistent(*item, handler);
+            });
+            return ok && handler.EndArray(static_cast<rapidjson::SizeType>(items.size()));
+        }
+        default: {
+            const auto& object = std::get<PersistentObject>(node.value);
+            if (!handler.StartObject()) return false;
+            const bool ok = object.forEach([&handler](const PersistentMember& member) {
+                const std::string& key = *member.first;
+                return handler.Key(key.data(), static_cast<rapidjson::SizeType>(key.size()), true) &&
+                       acceptPersistent(*member.second, handler);
+            });
+            return ok && handler.EndObject(static_cast<rapidjson::SizeType>(object.count));
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief 구조 공유 불변 document 핸들
+ *
+ * 핸들 복사는 버전 복사 (루트 포인터 하나), setter는 이 핸들만 새 버전으로 바꿈
+ *
+ * @code
+ * json::PersistentDocument v1;
+ * v1.parse(largeStateJson);
+ *
+ * json::PersistentDocument v2 = v1;           // O(1)
+ * v2.setInt64("/users/3/age", 31);            // "/users/3" 경로만 새 노드, 나머지는 v1과 공유
+ * v2.setString("/meta/owner", "kim");         // 없는 중간 객체는 생성
+ *
+ * v1.getInt64("/users/3/age");                // 이전 값 그대로
+ * history.push_back(v2);
+ * @endcode
+ *
+ * 수정 비용은 경로상 컨테이너마다 O(log32 자식 수) 노드 복사 (노드당 최대 32칸),
+ * 하위 트리 내용은 복사하지 않음 (배열 중간 요소 삭제만 그 배열 전체 재구성)
+ */
+class PersistentDocument {
+public:
+    PersistentDocument() : root_(detail::makePersistentNode(detail::PersistentObject())) {}
+
+    // ========================================
+    // 생성/변환
+    // ========================================
+
+    /**
+     * @brief JSON 문자열로 교체 (실패 시 기존 버전 유지)
+     */
+    inline bool parse(const std::string& jsonStr) {
+        detail::PersistentBuilder builder;
+        rapidjson::Reader reader;
+        rapidjson::StringStream stream(jsonStr.c_str());
+        if (reader.Parse<rapidjson::kParseNoFlags>(stream, builder).IsError() || !builder.root) return false;
+        root_ = std::move(builder.root);
+        return true;
+    }
+
+    inline bool parse(const ToJsonable& object) { return parse(object.toJson()); }
+
+    inline std::string toJson() const {
+        rapidjson::StringBuffer buffer;
+        detail::JsonWriter<rapidjson::StringBuffer> writer(buffer);
+        detail::acceptPersistent(*root_, writer);
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+
+    // 하위 트리만 JSON으로 (없으면 빈 문자열)
+    inline std::string toJson(const std::string& pointer) const {
+        const detail::PersistentNode* node = find(pointer);
+        if (!node) return std::string();
+        rapidjson::StringBuffer buffer;
+        detail::JsonWriter<rapidjson::StringBuffer> writer(buffer);
+        detail::acceptPersistent(*node, writer);
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+
+    inline void load(FromJsonable& object) const { object.fromJson(toJson()); }
+
+    // ========================================
+    // 읽기
+    // ========================================
+
+    inline bool has(const std::string& pointer) const { return find(pointer) != nullptr; }
+
+    inline bool isNull(const std::string& pointer) const { return is<std::monostate>(pointer); }
+    inline bool isArray(const std::string& pointer) const { return is<detail::PersistentArray>(pointer); }
+    inline bool isObject(const std::string& pointer) const { return is<detail::PersistentObject>(pointer); }
+
+    inline std::string getString(const std::string& pointer, const std::string& defaultValue = "") const {
+        const detail::PersistentNode* node = find(pointer);
+        const std::string* value = node ? std::get_if<std::string>(&node->value) : nullptr;
+        return value ? *value : defaultValue;
+    }
+
+    inline int64_t getInt64(const std::string& pointer, int64_t defaultValue = 0) const {
+        const detail::PersistentNode* node = find(pointer);
+        if (!node) return defaultValue;
+        if (const auto* i = std::get_if<int64_t>(&node->value)) return *i;
+        if (const auto* u = std::get_if<uint64_t>(&node->value)) return static_cast<int64_t>(*u);
+        if (const auto* d = std::get_if<double>(&node->value)) return static_cast<int64_t>(*d);
+        return defaultValue;
+    }
+
+    inline uint64_t getUInt64(const std::string& pointer, uint64_t defaultValue = 0) const {
+        const detail::PersistentNode* node = find(pointer);
+        if (!node) return defaultValue;
+        if (const auto* u = std::get_if<uint64_t>(&node->value)) return *u;
+        if (const auto* i = std::get_if<int64_t>(&node->value)) return *i >= 0 ? static_cast<uint64_t>(*i) : defaultValue;
+        return defaultValue;
+    }
+
+    inline double getDouble(const std::string& pointer, double defaultValue = 0.0) const {
+        const detail::PersistentNode* node = find(pointer);
+        if (!node) return defaultValue;
+        if (const auto* d = std::get_if<double>(&node->value)) return *d;
+        if (const auto* i = std::get_if<int64_t>(&node->value)) return static_cast<double>(*i);
+        if (const auto* u = std::get_if<uint64_t>(&node->value)) return static_cast<double>(*u);
+        return defaultValue;
+    }
+
+    inline bool getBool(const std::string& pointer, bool defaultValue = false) const {
+        const detail::PersistentNode* node = find(pointer);
+        const bool* value = node ? std::get_if<bool>(&node->value) : nullptr;
+        return value ? *value : defaultValue;
+    }
+
+    // 배열 요소 수 / 객체 멤버 수 (그 외 0)
+    inline size_t size(const std::string& pointer) const {
+        const detail::PersistentNode* node = find(pointer);
+        if (!node) return 0;
+        if (const auto* items = std::get_if<detail::PersistentArray>(&node->value)) return items->size();
+        if (const auto* object = std::get_if<detail::PersistentObject>(&node->value)) return object->count;
+        return 0;
+    }
+
+    // 객체 멤버 이름 (삽입 순서)
+    inline std::vector<std::string> keys(const std::string& pointer) const {
+        std::vector<std::string> result;
+        const detail::PersistentNode* node = find(pointer);
+        if (const auto* object = node ? std::get_if<detail::PersistentObject>(&node->value) : nullptr) {
+            result.reserve(object->count);
+            object->forEach([&result](const detail::PersistentMember& member) {
+                result.push_back(*member.first);
+                return true;
+            });
+        }
+        return result;
+    }
+
+    /**
+     * @brief 두 버전이 pointer 위치 하위 트리를 같은 노드로 공유하는지
+     */
+    inline bool sharesSubtree(const PersistentDocument& other, const std::string& pointer) const {
+        const detail::PersistentNode* mine = find(pointer);
+        return mine && mine == other.find(pointer);
+    }
+
+    // ========================================
+    // 쓰기 (이 핸들만 새 버전으로)
+    // ========================================
+
+    /**
+     * @brief 값 설정 (없는 중간 객체는 생성, 배열은 기존 인덱스 또는 끝("-"/size)만 가능)
+     *
+     * @return 경로가 스칼라를 지나거나 배열 인덱스가 범위를 벗어나면 false (버전 유지)
+     */
+    inline bool setString(const std::string& pointer, const std::string& value) {
+        return replace(pointer, detail::makePersistentNode(value));
+    }
+    inline bool setInt64(const std::string& pointer, int64_t value) {
+        return replace(pointer, detail::makePersistentNode(value));
+    }
+    inline bool setUInt64(const std::string& pointer, uint64_t value) {
+        return value <= static_cast<uint64_t>(INT64_MAX) ? setInt64(pointer, static_cast<int64_t>(value))
+                                                          : replace(pointer, detail::makePersistentNode(value));
+    }
+    inline bool setDouble(const std::string& pointer, double value) {
+        return replace(pointer, detail::makePersistentNode(value));
+    }
+    inline bool setBool(const std::string& pointer, bool value) {
+        return replace(pointer, detail::makePersistentNode(value));
+    }
+    inline bool setNull(const std::string& pointer) {
+        return replace(pointer, detail::makePersistentNode(std::monostate()));
+    }
+
+    /**
+     * @brief JSON 텍스트를 하위 트리로 설정
+     */
+    inline bool setJson(const std::string& pointer, const std::string& jsonStr) {
+        PersistentDocument subtree;
+        return subtree.parse(jsonStr) && replace(pointer, subtree.root_);
+    }
+
+    /**
+     * @brief 다른 버전의 하위 트리를 복사 없이 가져와 설정
+     */
+    inline bool setSubtree(const std::string& pointer, const PersistentDocument& source, const std::string& sourcePointer) {
+        detail::PersistentNodePtr node = source.findShared(sourcePointer);
+        return node && replace(pointer, std::move(node));
+    }
+
+    /**
+     * @brief 멤버/요소 삭제 (배열은 뒤 요소가 앞으로 당겨짐)
+     */
+    inline bool erase(const std::string& pointer) {
+        std::vector<std::string> tokens;
+        if (!detail::splitPointer(pointer, tokens) || tokens.empty()) return false;
+        detail::PersistentNodePtr updated;
+        if (!rebuild(root_, tokens, 0, nullptr, updated)) return false;
+        root_ = std::move(updated);
+        return true;
+    }
+
+private:
+    template<typename V>
+    inline bool is(const std::string& pointer) const {
+        const detail::PersistentNode* node = find(pointer);
+        return node && std::holds_alternative<V>(node->value);
+    }
+
+    inline const detail::PersistentNode* find(const std::string& pointer) const {
+        const detail::PersistentNodePtr shared = findShared(pointer);
+        return shared.get();
+    }
+
+    inline detail::PersistentNodePtr findShared(const std::string& pointer) const {
+        std::vector<std::string> tokens;
+        if (!detail::splitPointer(pointer, tokens)) return nullptr;
+        const detail::PersistentNodePtr* node = &root_;
+        for (const std::string& token : tokens) {
+            const auto& value = (*node)->value;
+            if (const auto* object = std::get_if<detail::PersistentObject>(&value)) {
+                node = detail::findMember(*object, token);
+            } else if (const auto* items = std::get_if<detail::PersistentArray>(&value)) {
+                size_t index;
+                node = detail::parseArrayIndex(token, items->size(), index) && index < items->size()
+                           ? &(*items)[index] : nullptr;
+            } else {
+                node = nullptr;
+            }
+            if (!node) return nullptr;
+        }
+        return *node;
+    }
+
+    inline bool replace(const std::string& pointer, detail::PersistentNodePtr value) {
+        std::vector<std::string> tokens;
+        if (!detail::splitPointer(pointer, tokens)) return false;
+        detail::PersistentNodePtr updated;
+        if (!rebuild(root_, tokens, 0, std::move(value), updated)) return false;
+        root_ = std::move(updated);
+        return true;
+    }
+
+    /**
+     * @brief 경로 복사: depth 위치 컨테이너의 트라이 경로만 새로 만들고 나머지 노드와 키는 포인터 공유
+     *
+     * value == nullptr 이면 마지막 토큰 삭제
+     */
+    static inline bool rebuild(const detail::PersistentNodePtr& node, const std::vector<std::string>& tokens,
+                               size_t depth, detail::PersistentNodePtr value, detail::PersistentNodePtr& out) {
+        if (depth == tokens.size()) {
+            out = std::move(value);
+            return out != nullptr;
+        }
+        const std::string& token = tokens[depth];
+        const bool last = depth + 1 == tokens.size();
+
+        if (!node || std::holds_alternative<detail::PersistentObject>(node->value)) {
+            // 없는 중간 경로는 빈 객체로 생성
+            static const detail::PersistentObject kEmpty;
+            const detail::PersistentObject& object = node ? std::get<detail::PersistentObject>(node->value) : kEmpty;
+            const size_t slot = object.find(token);
+            const bool found = slot != detail::PersistentObject::npos;
+            if (!value && last) {
+                if (!found) return false;
+                out = detail::makePersistentNode(object.without(slot));
+                return true;
+            }
+            detail::PersistentNodePtr child;
+            if (!rebuild(found ? object.members[slot].second : nullptr, tokens, depth + 1, std::move(value), child)) {
+                return false;
+            }
+            out = detail::makePersistentNode(found ? object.withChild(slot, std::move(child))
+                                                   : object.withMember(std::make_shared<const std::string>(token),
+                                                                       std::move(child)));
+            return true;
+        }
+
+        if (const auto* items = std::get_if<detail::PersistentArray>(&node->value)) {
+            size_t index;
+            if (!detail::parseArrayIndex(token, items->size(), index) || index > items->size()) return false;
+            if (!value && last) {
+                if (index >= items->size()) return false;
+                std::vector<detail::PersistentNodePtr> remaining = items->toVector();
+                remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(index));
+                out = detail::makePersistentNode(detail::PersistentArray(std::move(remaining)));
+                return true;
+            }
+            detail::PersistentNodePtr child;
+            if (!rebuild(index < items->size() ? (*items)[index] : nullptr, tokens, depth + 1, std::move(value), child)) {
+                return false;
+            }
+            out = detail::makePersistentNode(index < items->size() ? items->set(index, std::move(child))
+                                                                   : items->pushBack(std::move(child)));
+            return true;
+        }
+        return false;   // 스칼라를 지나는 경로
+    }
+
+    detail::PersistentNodePtr root_;
+};
+
+} // namespace json
@@ -0,0 +1,202 @@
+#pragma once
+
+/**
+ * JsonablePrototype.hpp - 타입별 프로토타입 레지스트리 (완전 inline)
+ *
+ * 역할: 완성된 객체(필드 + document)를 타입당 한 번만 만들어 두고
+ *       새 인스턴스는 그 객체를 복사해서 생성
+ *       - 복제 = 필드 복사 + document 통째 CopyFrom (파싱/saveToJson 없음)
+ *       - acquire()는 반납된 인스턴스 객체를 재사용 (document 메모리는 복제 시 새로 할당)
+ *       - 직렬화는 toJsonDocument()로 (toJson()은 saveToJson을 다시 실행함)
+ *
+ * 요청마다 거의 같은 응답 뼈대를 만드는 경우를 위한 것
+ * 정의/획득/반납은 mutex로 보호 (여러 요청 스레드에서 호출 가능)
+ */
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <utility>
+
+namespace json {
+
+/**
+ * @brief 타입 T의 프로토타입 레지스트리
+ *
+ * @code
+ * json::Prototype<Response>::define([](Response& r) {
+ *     r.version = "2.1";
+ *     r.status = "ok";
+ *     r.links = {...};
+ * });
+ *
+ * // 요청 처리
+ * auto response = json::Prototype<Response>::acquire();   // 반납되면 자동 재사용
+ * response->setString("requestId", id);                     // 요청별 값만 document에 기록
+ * send(response->toJsonDocument());                         // 뼈대를 다시 만들지 않고 직렬화
+ * @endcode
+ *
+ * T는 복사 생성/이동 대입이 가능해야 함 (Jsonable 기본 구현으로 충분)
+ */
+template<typename T>
+class Prototype {
+    struct Registry;
+
+public:
+    /**
+     * @brief 반납 시 레지스트리 풀로 되돌리는 deleter
+     */
+    struct Recycler {
+        std::shared_ptr<Registry> registry;
+
+        inline void operator()(T* object) const {
+            if (registry) registry->release(object);
+            else delete object;
+        }
+    };
+
+    using Handle = std::unique_ptr<T, Recycler>;
+
+    // ========================================
+    // 정의
+    // ========================================
+
+    /**
+     * @brief 필드를 채우는 함수로 프로토타입 정의 (document는 saveToJson 한 번으로 구성)
+     *
+     * 다시 정의하면 이후 clone/acquire부터 새 프로토타입 사용
+     */
+    template<typename Init>
+    static inline void define(Init&& init) {
+        auto object = std::make_shared<T>();
+        init(*object);
+        object->saveToJson();
+        registry()->setPrototype(std::move(object));
+    }
+
+    /**
+     * @brief JSON 문자열로 프로토타입 정의 (fromJson 한 번)
+     */
+    static inline void defineJson(const std::string& json) {
+        auto object = std::make_shared<T>();
+        object->fromJson(json);
+        registry()->setPrototype(std::move(object));
+    }
+
+    static inline bool defined() {
+        return registry()->prototype() != nullptr;
+    }
+
+    /**
+     * @brief 프로토타입 제거 (풀에 남은 인스턴스도 해제)
+     */
+    static inline void reset() {
+        registry()->setPrototype(nullptr);
+    }
+
+    // ========================================
+    // 인스턴스 생성
+    // ========================================
+
+    /**
+     * @brief 프로토타입 사본 (정의되지 않았으면 기본 생성 객체)
+     */
+    static inline T clone() {
+        auto prototype = registry()->prototype();
+        if (!prototype) return T();
+        return T(*prototype);
+    }
+
+    /**
+     * @brief 풀에서 인스턴스 획득 (정의되지 않았으면 nullptr)
+     *
+     * 반납된 객체가 있으면 새 복제본을 이동 대입해서 재사용, 없으면 새로 복제
+     * (이동 대입으로 이전 document 메모리를 해제하므로 재사용을 반복해도 커지지 않음)
+     */
+    static inline Handle acquire() {
+        auto shared = registry();
+        auto prototype = shared->prototype();
+        if (!prototype) return Handle(nullptr, Recycler{shared});
+
+        T* object = shared->take();
+        if (object) *object = T(*prototype);
+        else object = new T(*prototype);
+        return Handle(object, Recycler{shared});
+    }
+
+    // ========================================
+    // 풀 설정
+    // ========================================
+
+    /**
+     * @brief 보관할 반납 인스턴스 최대 수 (기본 64, 넘치면 해제)
+     */
+    static inline void setPoolCapacity(size_t capacity) {
+        registry()->setCapacity(capacity);
+    }
+
+    static inline size_t pooledCount() {
+        return registry()->pooled();
+    }
+
+private:
+    struct Registry {
+        std::mutex mutex;
+        std::shared_ptr<const T> current;
+        std::vector<std::unique_ptr<T>> pool;
+        size_t capacity = 64;
+
+        inline std::shared_ptr<const T> prototype() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return current;
+        }
+
+        inline void setPrototype(std::shared_ptr<const T> object) {
+            std::vector<std::unique_ptr<T>> dropped;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                current = std::move(object);
+                if (!current) dropped.swap(pool);
+            }
+        }
+
+        inline T* take() {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pool.empty()) return nullptr;
+            T* object = pool.back().release();
+            pool.pop_back();
+            return object;
+        }
+
+        inline void release(T* object) {
+            std::unique_ptr<T> owned(object);
+            std::lock_guard<std::mutex> lock(mutex);
+            if (current && pool.size() < capacity) pool.push_back(std::move(owned));
+        }
+
+        inline void setCapacity(size_t value) {
+            std::vector<std::unique_ptr<T>> dropped;
+            std::lock_guard<std::mutex> lock(mutex);
+            capacity = value;
+            while (pool.size() > capacity) {
+                dropped.push_back(std::move(pool.back()));
+                pool.pop_back();
+            }
+        }
+
+        inline size_t pooled() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return pool.size();
+        }
+    };
+
+    // 핸들이 레지스트리를 공유하므로 정적 소멸 순서와 무관하게 반납 가능
+    static inline std::shared_ptr<Registry> registry() {
+        static const std::shared_ptr<Registry> instance = std::make_shared<Registry>();
+        return instance;
+    }
+};
+
+} // namespace json
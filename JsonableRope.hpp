@@ -0,0 +1,173 @@
+#pragma once
+
+/**
+ * JsonableRope.hpp - 청크 목록 출력 버퍼 (완전 inline)
+ *
+ * 역할: 매우 큰 직렬화 출력을 고정 청크들에 나눠 기록
+ *       - 이미 쓴 바이트는 절대 이동하지 않음 (재할당 복사 없음)
+ *       - 청크 단위로 순차 소비 가능 (소비한 청크는 즉시 해제)
+ *       - 연속 문자열은 필요할 때만 toString()으로 한 번 복사
+ *
+ * 청크 크기는 작은 출력을 위해 4 KiB에서 시작해 1 MiB까지 두 배씩 증가
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace json {
+
+/**
+ * @brief 재할당 없이 늘어나는 rope 출력 버퍼
+ *
+ * RapidJSON OutputStream 개념(Put/Flush/Push)을 만족하므로 Writer가 직접 기록함
+ *
+ * @code
+ * json::RopeBuffer out;
+ * bigReport.toJson(out);                          // 1 GB여도 이미 쓴 바이트는 그대로
+ * out.drain([&](std::string_view piece) {         // 앞에서부터 소비하며 해제
+ *     socket.send(piece.data(), piece.size());
+ * });
+ * @endcode
+ */
+class RopeBuffer {
+public:
+    typedef char Ch;
+
+    static constexpr size_t kInitialChunkSize = 4 * 1024;
+    static constexpr size_t kMaxChunkSize = 1024 * 1024;
+
+    RopeBuffer() = default;
+
+    RopeBuffer(RopeBuffer&&) noexcept = default;
+    RopeBuffer& operator=(RopeBuffer&&) noexcept = default;
+    RopeBuffer(const RopeBuffer&) = delete;
+    RopeBuffer& operator=(const RopeBuffer&) = delete;
+
+    // ========================================
+    // OutputStream 개념
+    // ========================================
+
+    inline void Put(char c) {
+        if (chunks_.empty() || chunks_.back().size == chunks_.back().capacity) addChunk(1);
+        Chunk& chunk = chunks_.back();
+        chunk.data[chunk.size++] = c;
+        ++total_;
+    }
+
+    /**
+     * @brief 연속 count 바이트 확보 (현재 청크에 안 들어가면 새 청크 시작)
+     */
+    inline char* Push(size_t count) {
+        if (chunks_.empty() || chunks_.back().capacity - chunks_.back().size < count) addChunk(count);
+        Chunk& chunk = chunks_.back();
+        char* p = chunk.data.get() + chunk.size;
+        chunk.size += count;
+        total_ += count;
+        return p;
+    }
+
+    inline void Flush() {}
+
+    inline void append(const char* data, size_t size) {
+        while (size) {
+            if (chunks_.empty() || chunks_.back().size == chunks_.back().capacity) addChunk(size);
+            Chunk& chunk = chunks_.back();
+            const size_t n = std::min(size, chunk.capacity - chunk.size);
+            std::memcpy(chunk.data.get() + chunk.size, data, n);
+            chunk.size += n;
+            total_ += n;
+            data += n;
+            size -= n;
+        }
+    }
+
+    // ========================================
+    // 읽기 / 소비
+    // ========================================
+
+    inline size_t size() const { return total_; }
+    inline bool empty() const { return total_ == 0; }
+    inline size_t chunkCount() const { return chunks_.size(); }
+
+    inline std::string_view chunk(size_t index) const {
+        return std::string_view(chunks_[index].data.get(), chunks_[index].size);
+    }
+
+    template<typename Visitor>
+    inline void forEachChunk(Visitor&& visit) const {
+        for (const auto& chunk : chunks_) {
+            if (chunk.size) visit(std::string_view(chunk.data.get(), chunk.size));
+        }
+    }
+
+    /**
+     * @brief 앞 청크부터 consume에 넘기고 해제 (끝나면 빈 버퍼)
+     *
+     * consume(std::string_view)가 false를 반환하면 그 청크부터 남겨 두고 중단
+     * (void 반환이면 끝까지 진행)
+     *
+     * @return 소비한 바이트 수
+     */
+    template<typename Consumer>
+    inline size_t drain(Consumer&& consume) {
+        size_t consumed = 0;
+        size_t index = 0;
+        for (; index < chunks_.size(); ++index) {
+            Chunk& chunk = chunks_[index];
+            if (chunk.size) {
+                const std::string_view piece(chunk.data.get(), chunk.size);
+                if constexpr (std::is_same_v<decltype(consume(piece)), bool>) {
+                    if (!consume(piece)) break;
+                } else {
+                    consume(piece);
+                }
+                consumed += chunk.size;
+            }
+            chunk.data.reset();
+        }
+        chunks_.erase(chunks_.begin(), chunks_.begin() + static_cast<std::ptrdiff_t>(index));
+        total_ -= consumed;
+        return consumed;
+    }
+
+    /**
+     * @brief 연속 문자열로 복사 (호출 시에만 한 번)
+     */
+    inline std::string toString() const {
+        std::string result;
+        result.reserve(total_);
+        forEachChunk([&](std::string_view piece) { result.append(piece.data(), piece.size()); });
+        return result;
+    }
+
+    inline void clear() {
+        chunks_.clear();
+        total_ = 0;
+        nextChunkSize_ = kInitialChunkSize;
+    }
+
+private:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t size;
+        size_t capacity;
+    };
+
+    inline void addChunk(size_t minimum) {
+        const size_t capacity = std::max(nextChunkSize_, minimum);
+        chunks_.push_back(Chunk{std::unique_ptr<char[]>(new char[capacity]), 0, capacity});
+        nextChunkSize_ = std::min(nextChunkSize_ * 2, kMaxChunkSize);
+    }
+
+    std::vector<Chunk> chunks_;
+    size_t total_ = 0;
+    size_t nextChunkSize_ = kInitialChunkSize;
+};
+
+} // namespace json
@@ -0,0 +1,342 @@
+#pragma once
+
+/**
+ * JsonableScan.hpp - document 없는 필드 스캐너 (완전 inline)
+ *
+ * 역할: JSON 객체 텍스트에서 지정한 필드(점 경로)의 값 위치만 찾아냄
+ *       - 트리/문자열 복사/숫자 변환 없이 원문 범위(포인터 + 길이)만 기록
+ *       - 관심 없는 값은 괄호 깊이와 문자열 경계만 보고 건너뜀
+ *       - 필요한 필드를 모두 찾으면 나머지 텍스트는 읽지 않음
+ *
+ * 문법 검증은 하지 않음 (잘못된 입력에서 끝 경계를 넘지 않는 것만 보장)
+ * 키는 원문 바이트로 비교하므로 이스케이프가 들어간 키는 일치하지 않음
+ */
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace json {
+namespace detail {
+
+enum class ScanKind : uint8_t { Missing, Null, Bool, Number, String, Object, Array };
+
+/**
+ * @brief 스캔된 값의 원문 범위
+ *
+ * String: 따옴표 안쪽 (escaped면 unescapeString()으로 복원 필요)
+ * 그 외: 값 텍스트 전체 (Object/Array는 괄호 포함)
+ */
+struct ScanValue {
+    ScanKind kind = ScanKind::Missing;
+    bool escaped = false;
+    const char* text = nullptr;
+    size_t length = 0;
+};
+
+inline const char* skipSpace(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) ++p;
+    return p;
+}
+
+/**
+ * @brief 문자열 본문 건너뛰기 (p: 여는 따옴표 다음)
+ *
+ * @return 닫는 따옴표 위치, 끝나지 않은 문자열이면 nullptr
+ */
+inline const char* skipStringBody(const char* p, const char* end, bool& escaped) {
+    escaped = false;
+    for (;;) {
+        const char* quote = static_cast<const char*>(std::memchr(p, '"', static_cast<size_t>(end - p)));
+        if (!quote) return nullptr;
+        // 앞쪽 연속 역슬래시가 홀수면 이스케이프된 따옴표
+        const char* back = quote;
+        while (back > p && back[-1] == '\\') --back;
+        if (back != quote) escaped = true;
+        if (((quote - back) & 1) == 0) {
+            if (!escaped && std::memchr(p, '\\', static_cast<size_t>(quote - p))) escaped = true;
+            return quote;
+        }
+        p = quote + 1;
+    }
+}
+
+/**
+ * @brief 값 하나 건너뛰기 (p: 값의 첫 문자)
+ *
+ * @return 값 바로 다음 위치, 잘못된 입력이면 nullptr
+ */
+inline const char* skipValue(const char* p, const char* end, ScanKind& kind, bool& escaped) {
+    if (p >= end) return nullptr;
+    escaped = false;
+    switch (*p) {
+        case '"': {
+            kind = ScanKind::String;
+            const char* close = skipStringBody(p + 1, end, escaped);
+            return close ? close + 1 : nullptr;
+        }
+        case '{':
+        case '[': {
+            kind = *p == '{' ? ScanKind::Object : ScanKind::Array;
+            size_t depth = 0;
+            bool inner;
+            for (; p < end; ++p) {
+                const char c = *p;
+                if (c == '"') {
+                    p = skipStringBody(p + 1, end, inner);
+                    if (!p) return nullptr;
+                } else if (c == '{' || c == '[') {
+                    ++depth;
+                } else if ((c == '}' || c == ']') && --depth == 0) {
+                    return p + 1;
+                }
+            }
+            return nullptr;
+        }
+        default: {
+            kind = *p == 'n' ? ScanKind::Null
+                 : (*p == 't' || *p == 'f') ? ScanKind::Bool
+                 : ScanKind::Number;
+            const char* start = p;
+            while (p < end && *p != ',' && *p != '}' && *p != ']' &&
+                   *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') {
+                ++p;
+            }
+            return p > start ? p : nullptr;
+        }
+    }
+}
+
+inline void appendUtf8(std::string& out, uint32_t code) {
+    if (code < 0x80) {
+        out += static_cast<char>(code);
+    } else if (code < 0x800) {
+        out += static_cast<char>(0xC0 | (code >> 6));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        out += static_cast<char>(0xE0 | (code >> 12));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (code >> 18));
+        out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+inline bool parseHex4(const char* p, const char* end, uint32_t& code) {
+    if (end - p < 4) return false;
+    code = 0;
+    for (int i = 0; i < 4; ++i) {
+        const char c = p[i];
+        const uint32_t digit = (c >= '0' && c <= '9') ? static_cast<uint32_t>(c - '0')
+                             : (c >= 'a' && c <= 'f') ? static_cast<uint32_t>(c - 'a' + 10)
+                             : (c >= 'A' && c <= 'F') ? static_cast<uint32_t>(c - 'A' + 10)
+                             : 16;
+        if (digit == 16) return false;
+        code = (code << 4) | digit;
+    }
+    return true;
+}
+
+/**
+ * @brief 문자열 본문(따옴표 안쪽)의 이스케이프 복원
+ */
+inline bool unescapeString(const char* text, size_t length, std::string& out) {
+    out.clear();
+    out.reserve(length);
+    const char* p = text;
+    const char* end = text + length;
+    while (p < end) {
+        const char* slash = static_cast<const char*>(std::memchr(p, '\\', static_cast<size_t>(end - p)));
+        if (!slash) {
+            out.append(p, end);
+            return true;
+        }
+        out.append(p, slash);
+        if (slash + 1 >= end) return false;
+        p = slash + 2;
+        switch (slash[1]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                uint32_t code;
+                if (!parseHex4(p, end, code)) return false;
+                p += 4;
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    uint32_t low;
+                    if (end - p < 6 || p[0] != '\\' || p[1] != 'u' || !parseHex4(p + 2, end, low) ||
+                        low < 0xDC00 || low > 0xDFFF) {
+                        return false;
+                    }
+                    p += 6;
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                appendUtf8(out, code);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 지정한 필드 경로들의 값 위치를 한 번의 순회로 찾는 스캐너
+ *
+ * @code
+ * json::detail::FieldScanner scanner({"region", "http.status", "bytes"});
+ * std::vector<json::detail::ScanValue> values(scanner.fieldCount());
+ * if (scanner.scan(line, length, values.data())) {
+ *     // values[1].kind == ScanKind::Number, values[1].text == "200" ...
+ * }
+ * @endcode
+ *
+ * 경로는 '.'으로 중첩 객체를 따라감 (배열 안은 탐색하지 않음)
+ * 같은 키가 여러 번 나오면 첫 값을 사용
+ */
+class FieldScanner {
+public:
+    explicit FieldScanner(const std::vector<std::string>& paths) : fieldCount_(paths.size()) {
+        nodes_.emplace_back();
+        for (size_t field = 0; field < paths.size(); ++field) {
+            size_t node = 0;
+            size_t start = 0;
+            const std::string& path = paths[field];
+            for (;;) {
+                const size_t dot = path.find('.', start);
+                node = child(node, path.substr(start, dot == std::string::npos ? std::string::npos : dot - start));
+                if (dot == std::string::npos) break;
+                start = dot + 1;
+            }
+            nodes_[node].fields.push_back(field);
+        }
+        for (const Node& node : nodes_) leafCount_ += node.fields.empty() ? 0 : 1;
+    }
+
+    inline size_t fieldCount() const { return fieldCount_; }
+
+    /**
+     * @brief 객체 텍스트 하나 스캔
+     *
+     * @param out fieldCount()개 (찾지 못한 필드는 Missing)
+     * @return 최상위가 객체가 아니거나 필요한 필드 전에 입력이 깨졌으면 false
+     */
+    inline bool scan(const char* text, size_t length, ScanValue* out) const {
+        for (size_t i = 0; i < fieldCount_; ++i) out[i] = ScanValue();
+        const char* end = text + length;
+        const char* p = skipSpace(text, end);
+        if (p >= end || *p != '{') return false;
+        size_t found = 0;
+        return scanObject(p, end, 0, out, found) != nullptr || found == leafCount_;
+    }
+
+private:
+    struct Node {
+        std::vector<std::pair<std::string, size_t>> children;
+        std::vector<size_t> fields;
+    };
+
+    inline size_t child(size_t node, const std::string& name) {
+        for (const auto& entry : nodes_[node].children) {
+            if (entry.first == name) return entry.second;
+        }
+        const size_t index = nodes_.size();
+        nodes_[node].children.emplace_back(name, index);
+        nodes_.emplace_back();
+        return index;
+    }
+
+    inline const Node* match(const Node& node, const char* key, size_t length) const {
+        for (const auto& entry : node.children) {
+            if (entry.first.size() == length && std::memcmp(entry.first.data(), key, length) == 0) {
+                return &nodes_[entry.second];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @return 객체 다음 위치, 깨진 입력이거나 모든 필드를 찾아 중단했으면 nullptr
+     */
+    inline const char* scanObject(const char* p, const char* end, size_t nodeIndex,
+                                  ScanValue* out, size_t& found) const {
+        const Node& node = nodes_[nodeIndex];
+        p = skipSpace(p + 1, end);
+        if (p < end && *p == '}') return p + 1;
+
+        while (p < end) {
+            if (*p != '"') return nullptr;
+            bool escaped;
+            const char* keyEnd = skipStringBody(p + 1, end, escaped);
+            if (!keyEnd) return nullptr;
+            const Node* target = match(node, p + 1, static_cast<size_t>(keyEnd - p - 1));
+
+            p = skipSpace(keyEnd + 1, end);
+            if (p >= end || *p != ':') return nullptr;
+            p = skipSpace(p + 1, end);
+
+            ScanKind kind;
+            const char* valueEnd;
+            if (target && !target->children.empty() && p < end && *p == '{') {
+                // 중첩 경로: 객체 안으로 들어감 (이 키 자체도 요청되었으면 범위 기록)
+                const size_t targetIndex = static_cast<size_t>(target - nodes_.data());
+                if (target->fields.empty()) {
+                    valueEnd = scanObject(p, end, targetIndex, out, found);
+                } else {
+                    valueEnd = skipValue(p, end, kind, escaped);
+                    if (valueEnd) {
+                        record(*target, ScanKind::Object, false, p, valueEnd, out, found);
+                        scanObject(p, end, targetIndex, out, found);
+                    }
+                }
+            } else {
+                valueEnd = skipValue(p, end, kind, escaped);
+                if (valueEnd && target && !target->fields.empty()) {
+                    record(*target, kind, escaped, p, valueEnd, out, found);
+                }
+            }
+            if (found == leafCount_ || !valueEnd) return nullptr;
+
+            p = skipSpace(valueEnd, end);
+            if (p < end && *p == '}') return p + 1;
+            if (p >= end || *p != ',') return nullptr;
+            p = skipSpace(p + 1, end);
+        }
+        return nullptr;
+    }
+
+    inline void record(const Node& node, ScanKind kind, bool escaped, const char* begin, const char* valueEnd,
+                       ScanValue* out, size_t& found) const {
+        if (out[node.fields.front()].kind != ScanKind::Missing) return;   // 중복 키: 첫 값 유지
+        ScanValue value;
+        value.kind = kind;
+        value.escaped = escaped;
+        if (kind == ScanKind::String) {
+            value.text = begin + 1;
+            value.length = static_cast<size_t>(valueEnd - begin - 2);
+        } else {
+            value.text = begin;
+            value.length = static_cast<size_t>(valueEnd - begin);
+        }
+        for (size_t field : node.fields) out[field] = value;
+        ++found;
+    }
+
+    std::vector<Node> nodes_;
+    size_t fieldCount_;
+    size_t leafCount_ = 0;
+};
+
+} // namespace detail
+} // namespace json
@@ -0,0 +1,392 @@
+#pragma once
+
+/**
+ * JsonableShmRing.hpp - 공유 메모리 링 버퍼 메시지 전송 (완전 inline, POSIX 전용)
+ *
+ * 역할: 같은 호스트의 프로세스 간 Jsonable 메시지 교환
+ *       - 송신: 슬롯을 먼저 확보하고 toJsonSink()로 슬롯 메모리에 바로 직렬화
+ *       - 수신: 슬롯 메모리를 제자리(in-situ) 파싱 후 슬롯 반환
+ *       (소켓 경로의 직렬화 → 복사 → syscall → 복사 → 파싱 중 복사/syscall 제거)
+ *
+ * 슬롯 큐는 Vyukov bounded MPMC 방식 (슬롯별 sequence 번호, 잠금 없음)
+ * 다중 송신자/다중 수신자 프로세스 모두 허용
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define JSONABLE_HAS_SHM_RING 1
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ToJsonable.hpp"
+#include "FromJsonable.hpp"
+
+namespace json {
+namespace detail {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared memory ring requires lock-free 64-bit atomics");
+
+constexpr uint32_t kShmRingMagic = 0x4A534852;   // "JSHR"
+constexpr uint32_t kShmRingVersion = 1;
+constexpr size_t kShmCacheLine = 64;
+
+// 직렬화 도중 슬롯 크기를 넘어 버려진 메시지 (수신 측은 건너뜀)
+constexpr uint32_t kShmDroppedLength = UINT32_MAX;
+
+/**
+ * @brief 공유 메모리 맨 앞 헤더 (송신/수신 위치는 서로 다른 캐시 라인)
+ */
+struct ShmRingHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t slotSize;
+    uint64_t slotStride;
+    alignas(kShmCacheLine) std::atomic<uint64_t> enqueuePos;
+    alignas(kShmCacheLine) std::atomic<uint64_t> dequeuePos;
+};
+
+/**
+ * @brief 슬롯 머리 (데이터는 바로 뒤에 slotSize + 1 바이트, 마지막은 '\0' 자리)
+ */
+struct ShmSlotHeader {
+    std::atomic<uint64_t> sequence;
+    uint32_t length;
+    uint32_t reserved;
+};
+
+/**
+ * @brief 확보한 슬롯의 sequence를 범위를 벗어날 때 공개
+ *
+ * 슬롯을 잡은 동안 사용자 코드(saveToJson/loadFromJson/방문자)가 예외로 빠져나가도
+ * 슬롯이 확보 상태로 남아 링 전체(연결된 모든 프로세스)가 멈추지 않게 함
+ */
+struct SlotRelease {
+    ShmSlotHeader* slot;
+    uint64_t sequence;
+
+    ~SlotRelease() { slot->sequence.store(sequence, std::memory_order_release); }
+};
+
+inline size_t alignToCacheLine(size_t size) {
+    return (size + kShmCacheLine - 1) & ~(kShmCacheLine - 1);
+}
+
+/**
+ * @brief 슬롯 데이터 영역에 쓰는 출력 스트림 (넘치면 기록 중단 후 표시)
+ */
+class SlotStream {
+public:
+    typedef char Ch;
+
+    SlotStream(char* begin, size_t capacity) : begin_(begin), current_(begin), end_(begin + capacity) {}
+
+    inline void Put(Ch c) {
+        if (current_ < end_) {
+            *current_++ = c;
+        } else {
+            overflow_ = true;
+        }
+    }
+    inline void Flush() {}
+
+    inline size_t size() const { return static_cast<size_t>(current_ - begin_); }
+    inline bool overflowed() const { return overflow_; }
+
+private:
+    char* begin_;
+    char* current_;
+    char* end_;
+    bool overflow_ = false;
+};
+
+} // namespace detail
+
+/**
+ * @brief POSIX 공유 메모리 메시지 링
+ *
+ * @code
+ * // 생성 측 (보통 수신 프로세스)
+ * json::ShmRing ring;
+ * ring.create("/orders", 1024, 16 * 1024);   // 슬롯 1024개 × 16KiB
+ *
+ * // 송신 프로세스
+ * json::ShmRing tx;
+ * tx.open("/orders");
+ * tx.send(order);                             // 링이 가득 찼거나 슬롯보다 크면 false
+ *
+ * // 수신
+ * Order received;
+ * while (ring.receive(received)) { ... }
+ *
+ * json::ShmRing::remove("/orders");           // 이름 제거 (열린 매핑은 유지)
+ * @endcode
+ *
+ * 같은 객체를 여러 스레드가 동시에 send/receive 해도 안전함 (open/close 제외)
+ */
+class ShmRing {
+public:
+    ShmRing() = default;
+    ~ShmRing() { close(); }
+
+    ShmRing(const ShmRing&) = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    ShmRing(ShmRing&& other) noexcept { *this = std::move(other); }
+
+    ShmRing& operator=(ShmRing&& other) noexcept {
+        if (this != &other) {
+            close();
+            std::swap(base_, other.base_);
+            std::swap(mappedSize_, other.mappedSize_);
+            std::swap(header_, other.header_);
+        }
+        return *this;
+    }
+
+    // ========================================
+    // 생성/연결
+    // ========================================
+
+    /**
+     * @brief 새 링 생성 (같은 이름이 이미 있으면 실패)
+     *
+     * @param name shm_open 이름 ("/name" 형식)
+     * @param slotCount 슬롯 수 (2의 거듭제곱)
+     * @param slotSize 메시지 최대 바이트 수
+     */
+    inline bool create(const std::string& name, uint32_t slotCount, uint32_t slotSize) {
+        close();
+        if (slotCount < 2 || (slotCount & (slotCount - 1)) != 0 || slotSize == 0) return false;
+
+        const uint64_t stride = detail::alignToCacheLine(sizeof(detail::ShmSlotHeader) + size_t(slotSize) + 1);
+        const size_t total = detail::alignToCacheLine(sizeof(detail::ShmRingHeader)) + stride * slotCount;
+
+        const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) return false;
+        if (::ftruncate(fd, static_cast<off_t>(total)) != 0 || !map(fd, total)) {
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            return false;
+        }
+        ::close(fd);
+
+        auto* header = new (base_) detail::ShmRingHeader;
+        header->version = detail::kShmRingVersion;
+        header->slotCount = slotCount;
+        header->slotSize = slotSize;
+        header->slotStride = stride;
+        header->enqueuePos.store(0, std::memory_order_relaxed);
+        header->dequeuePos.store(0, std::memory_order_relaxed);
+        header_ = header;
+        for (uint32_t i = 0; i < slotCount; ++i) {
+            auto* slot = new (slotAt(i)) detail::ShmSlotHeader;
+            slot->sequence.store(i, std::memory_order_relaxed);
+            slot->length = 0;
+        }
+        // 초기화가 끝난 뒤 magic 공개 (open 측은 magic으로 완료 확인)
+        header->magic.store(detail::kShmRingMagic, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 기존 링에 연결 (형식이 맞지 않으면 실패)
+     */
+    inline bool open(const std::string& name) {
+        close();
+        const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0) return false;
+
+        struct stat info;
+        const bool ok = ::fstat(fd, &info) == 0 &&
+                        static_cast<size_t>(info.st_size) >= sizeof(detail::ShmRingHeader) &&
+                        map(fd, static_cast<size_t>(info.st_size));
+        ::close(fd);
+        if (!ok) return false;
+
+        auto* header = reinterpret_cast<detail::ShmRingHeader*>(base_);
+        // 인덱스 마스킹 전에 형식 확인 (슬롯 수는 2의 거듭제곱, 보폭은 슬롯을 담을 만큼)
+        const uint32_t slotCount = header->slotCount;
+        if (slotCount < 2 || (slotCount & (slotCount - 1)) != 0 || header->slotSize == 0 ||
+            header->slotStride < sizeof(detail::ShmSlotHeader) + size_t(header->slotSize) + 1) {
+            unmap();
+            return false;
+        }
+        const size_t expected = detail::alignToCacheLine(sizeof(detail::ShmRingHeader)) +
+                                header->slotStride * header->slotCount;
+        if (header->magic.load(std::memory_order_acquire) != detail::kShmRingMagic ||
+            header->version != detail::kShmRingVersion || expected > mappedSize_) {
+            unmap();
+            return false;
+        }
+        header_ = header;
+        return true;
+    }
+
+    inline void close() {
+        unmap();
+    }
+
+    /**
+     * @brief 공유 메모리 이름 제거 (이미 연결된 프로세스의 매핑은 유지)
+     */
+    static inline bool remove(const std::string& name) {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+    inline bool isOpen() const { return header_ != nullptr; }
+    inline uint32_t slotCount() const { return header_ ? header_->slotCount : 0; }
+    inline uint32_t slotSize() const { return header_ ? header_->slotSize : 0; }
+
+    // ========================================
+    // 송신
+    // ========================================
+
+    /**
+     * @brief 메시지를 슬롯에 바로 직렬화하여 전송
+     *
+     * @return 링이 가득 찼거나 직렬화 결과가 slotSize를 넘으면 false
+     *         (넘친 경우 확보한 슬롯은 버림 표시 후 반환되어 수신 측이 건너뜀)
+     */
+    inline bool send(const ToJsonable& message) {
+        return produce([&](detail::SlotStream& stream) { return message.toJsonSink(stream); });
+    }
+
+    /**
+     * @brief 이미 직렬화된 JSON 전송
+     */
+    inline bool send(const char* json, size_t length) {
+        return produce([&](detail::SlotStream& stream) {
+            for (size_t i = 0; i < length; ++i) stream.Put(json[i]);
+            return true;
+        });
+    }
+
+    // ========================================
+    // 수신
+    // ========================================
+
+    /**
+     * @brief 다음 메시지를 슬롯에서 제자리 파싱하여 로드
+     *
+     * @return 링이 비어 있으면 false
+     */
+    inline bool receive(FromJsonable& message) {
+        return consume([&](char* json, size_t) { message.fromJsonInsitu(json); });
+    }
+
+    /**
+     * @brief 다음 메시지 버퍼를 직접 방문 (visit 반환 후 슬롯 재사용됨)
+     *
+     * @param visit void(char* json, size_t length), json은 '\0' 종료
+     */
+    template<typename Visitor>
+    inline bool receiveRaw(Visitor&& visit) {
+        return consume(std::forward<Visitor>(visit));
+    }
+
+private:
+    inline bool map(int fd, size_t size) {
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED) return false;
+        base_ = static_cast<char*>(address);
+        mappedSize_ = size;
+        return true;
+    }
+
+    inline void unmap() {
+        if (base_) ::munmap(base_, mappedSize_);
+        base_ = nullptr;
+        mappedSize_ = 0;
+        header_ = nullptr;
+    }
+
+    inline detail::ShmSlotHeader* slotAt(uint64_t index) const {
+        const size_t offset = detail::alignToCacheLine(sizeof(detail::ShmRingHeader)) +
+                              static_cast<size_t>(index & (header_->slotCount - 1)) * header_->slotStride;
+        return reinterpret_cast<detail::ShmSlotHeader*>(base_ + offset);
+    }
+
+    static inline char* slotData(detail::ShmSlotHeader* slot) {
+        return reinterpret_cast<char*>(slot + 1);
+    }
+
+    template<typename Fill>
+    inline bool produce(Fill&& fill) {
+        if (!header_) return false;
+
+        uint64_t pos = header_->enqueuePos.load(std::memory_order_relaxed);
+        detail::ShmSlotHeader* slot;
+        for (;;) {
+            slot = slotAt(pos);
+            const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(sequence - pos);
+            if (diff == 0) {
+                if (header_->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;   // 가득 참
+            } else {
+                pos = header_->enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        // fill이 예외를 던지면 버림 표시인 채로 공개됨 (수신 측은 건너뜀)
+        detail::SlotRelease release{slot, pos + 1};
+        slot->length = detail::kShmDroppedLength;
+        detail::SlotStream stream(slotData(slot), header_->slotSize);
+        const bool ok = fill(stream) && !stream.overflowed();
+        if (ok) slot->length = static_cast<uint32_t>(stream.size());
+        return ok;
+    }
+
+    template<typename Visitor>
+    inline bool consume(Visitor&& visit) {
+        if (!header_) return false;
+
+        for (;;) {
+            uint64_t pos = header_->dequeuePos.load(std::memory_order_relaxed);
+            detail::ShmSlotHeader* slot;
+            for (;;) {
+                slot = slotAt(pos);
+                const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+                const int64_t diff = static_cast<int64_t>(sequence - (pos + 1));
+                if (diff == 0) {
+                    if (header_->dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                } else if (diff < 0) {
+                    return false;   // 비어 있음
+                } else {
+                    pos = header_->dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+
+            // 한 바퀴 뒤의 송신자에게 슬롯 반환 (visit이 예외를 던져도 반환)
+            detail::SlotRelease release{slot, pos + header_->slotCount};
+            const uint32_t length = slot->length;
+            if (length == detail::kShmDroppedLength) continue;
+            char* data = slotData(slot);
+            data[length] = '\0';
+            visit(data, static_cast<size_t>(length));
+            return true;
+        }
+    }
+
+    char* base_ = nullptr;
+    size_t mappedSize_ = 0;
+    detail::ShmRingHeader* header_ = nullptr;
+};
+
+} // namespace json
+
+#endif // __unix__ || __APPLE__
@@ -0,0 +1,584 @@
+#pragma once
+
+/**
+ * JsonableStatic.hpp - 컴파일 타임 파싱 JSON 리터럴 (완전 inline)
+ *
+ * 역할: 문자열 리터럴을 constexpr로 검증/파싱하여 정적 읽기 전용 노드 표로 보관
+ *       - 잘못된 리터럴은 빌드 오류 (constexpr 변수 초기화 시)
+ *       - 시작 시 파싱 비용 없음: 값 조회는 constexpr, Jsonable 로드는 SAX 이벤트 직결
+ *
+ * 숫자는 원문을 함께 보관하여 Jsonable/JSON 출력 시 원문 그대로 전달,
+ * constexpr asDouble()은 유효 숫자 19자리·10진 지수 ±22 안에서 정확 (밖은 근사)
+ */
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/writer.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "JsonableWriter.hpp"
+#include "FromJsonable.hpp"
+
+namespace json {
+namespace detail {
+
+enum class StaticType : uint8_t { Null, False, True, Int64, UInt64, Double, String, Array, Object };
+
+/**
+ * @brief 전위 순서 노드 (컨테이너 자식은 바로 뒤에 이어짐)
+ */
+struct StaticNode {
+    StaticType type = StaticType::Null;
+    uint32_t next = 0;          // 이 값의 하위 트리 다음 노드 인덱스
+    uint32_t count = 0;         // 컨테이너 자식 수
+    uint32_t keyOffset = 0;     // 부모가 객체일 때 멤버 이름 (문자열 버퍼)
+    uint32_t keyLength = 0;
+    uint32_t textOffset = 0;    // 문자열 값 / 숫자 원문 (문자열 버퍼)
+    uint32_t textLength = 0;
+    int64_t i = 0;
+    uint64_t u = 0;
+    double d = 0.0;
+};
+
+// constexpr 평가 중 호출되면 컴파일 오류가 됨 (잘못된 JSON 리터럴)
+inline void invalidJsonLiteral() {}
+
+/**
+ * @brief constexpr JSON 파서
+ *
+ * nodes/strings가 nullptr이면 개수만 셈 (저장 공간 크기 계산용)
+ * 문자열 버퍼 사용량은 항상 입력 길이 이하
+ */
+class StaticParser {
+public:
+    constexpr StaticParser(const char* text, size_t length, StaticNode* nodes, size_t nodeCapacity, char* strings)
+        : text_(text), length_(length), nodes_(nodes), nodeCapacity_(nodeCapacity), strings_(strings) {}
+
+    constexpr bool parse() {
+        skipSpace();
+        if (!parseValue(0, 0, 0)) return false;
+        skipSpace();
+        return pos_ == length_ && (!nodes_ || nodeCount_ <= nodeCapacity_);
+    }
+
+    constexpr size_t nodeCount() const { return nodeCount_; }
+
+private:
+    static constexpr size_t kMaxDepth = 128;
+
+    constexpr void skipSpace() {
+        while (pos_ < length_ && (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    constexpr bool consume(char c) {
+        if (pos_ < length_ && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    constexpr bool consumeWord(const char* word) {
+        for (size_t i = 0; word[i]; ++i) {
+            if (!consume(word[i])) return false;
+        }
+        return true;
+    }
+
+    constexpr void put(char c) {
+        if (strings_) strings_[stringCount_] = c;
+        ++stringCount_;
+    }
+
+    // 기록할 노드 (개수만 셀 때, 노드 표가 모자랄 때는 nullptr → parse()가 실패 반환)
+    constexpr StaticNode* at(uint32_t index) {
+        return (nodes_ && index < nodeCapacity_) ? &nodes_[index] : nullptr;
+    }
+
+    constexpr uint32_t newNode(StaticType type, uint32_t keyOffset, uint32_t keyLength) {
+        const uint32_t index = static_cast<uint32_t>(nodeCount_++);
+        if (StaticNode* node = at(index)) {
+            node->type = type;
+            node->keyOffset = keyOffset;
+            node->keyLength = keyLength;
+        }
+        return index;
+    }
+
+    constexpr bool parseValue(uint32_t keyOffset, uint32_t keyLength, size_t depth) {
+        if (pos_ >= length_ || depth > kMaxDepth) return false;
+        const char c = text_[pos_];
+        if (c == '{' || c == '[') return parseContainer(c == '{', keyOffset, keyLength, depth);
+        if (c == '"') {
+            uint32_t offset = 0;
+            uint32_t length = 0;
+            if (!parseString(offset, length)) return false;
+            const uint32_t index = newNode(StaticType::String, keyOffset, keyLength);
+            setText(index, offset, length);
+            return true;
+        }
+        if (c == 't' || c == 'f' || c == 'n') {
+            const StaticType type = c == 't' ? StaticType::True : c == 'f' ? StaticType::False : StaticType::Null;
+            if (!consumeWord(c == 't' ? "true" : c == 'f' ? "false" : "null")) return false;
+            const uint32_t index = newNode(type, keyOffset, keyLength);
+            if (StaticNode* node = at(index)) node->next = index + 1;
+            return true;
+        }
+        return parseNumber(keyOffset, keyLength);
+    }
+
+    constexpr void setText(uint32_t index, uint32_t offset, uint32_t length) {
+        if (StaticNode* node = at(index)) {
+            node->textOffset = offset;
+            node->textLength = length;
+            node->next = index + 1;
+        }
+    }
+
+    constexpr bool parseContainer(bool isObject, uint32_t keyOffset, uint32_t keyLength, size_t depth) {
+        const uint32_t index = newNode(isObject ? StaticType::Object : StaticType::Array, keyOffset, keyLength);
+        ++pos_;
+        uint32_t count = 0;
+        skipSpace();
+        if (!consume(isObject ? '}' : ']')) {
+            for (;;) {
+                skipSpace();
+                uint32_t childKeyOffset = 0;
+                uint32_t childKeyLength = 0;
+                if (isObject) {
+                    if (pos_ >= length_ || text_[pos_] != '"' || !parseString(childKeyOffset, childKeyLength)) return false;
+                    skipSpace();
+                    if (!consume(':')) return false;
+                    skipSpace();
+                }
+                if (!parseValue(childKeyOffset, childKeyLength, depth + 1)) return false;
+                ++count;
+                skipSpace();
+                if (consume(',')) continue;
+                if (consume(isObject ? '}' : ']')) break;
+                return false;
+            }
+        }
+        if (StaticNode* node = at(index)) {
+            node->count = count;
+            node->next = static_cast<uint32_t>(nodeCount_);
+        }
+        return true;
+    }
+
+    static constexpr int hexValue(char c) {
+        return (c >= '0' && c <= '9') ? c - '0'
+             : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+             : (c >= 'A' && c <= 'F') ? c - 'A' + 10
+             : -1;
+    }
+
+    constexpr bool parseHex4(uint32_t& code) {
+        if (length_ - pos_ < 4) return false;
+        code = 0;
+        for (int i = 0; i < 4; ++i) {
+            const int digit = hexValue(text_[pos_++]);
+            if (digit < 0) return false;
+            code = (code << 4) | static_cast<uint32_t>(digit);
+        }
+        return true;
+    }
+
+    constexpr void putUtf8(uint32_t code) {
+        if (code < 0x80) {
+            put(static_cast<char>(code));
+        } else if (code < 0x800) {
+            put(static_cast<char>(0xC0 | (code >> 6)));
+            put(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            put(static_cast<char>(0xE0 | (code >> 12)));
+            put(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            put(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            put(static_cast<char>(0xF0 | (code >> 18)));
+            put(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            put(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            put(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    // 이스케이프를 풀어 문자열 버퍼에 기록
+    constexpr bool parseString(uint32_t& offset, uint32_t& length) {
+        ++pos_;   // 여는 따옴표
+        offset = static_cast<uint32_t>(stringCount_);
+        while (pos_ < length_) {
+            const char c = text_[pos_++];
+            if (c == '"') {
+                length = static_cast<uint32_t>(stringCount_ - offset);
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) return false;
+            if (c != '\\') {
+                put(c);
+                continue;
+            }
+            if (pos_ >= length_) return false;
+            const char escape = text_[pos_++];
+            switch (escape) {
+                case '"': put('"'); break;
+                case '\\': put('\\'); break;
+                case '/': put('/'); break;
+                case 'b': put('\b'); break;
+                case 'f': put('\f'); break;
+                case 'n': put('\n'); break;
+                case 'r': put('\r'); break;
+                case 't': put('\t'); break;
+                case 'u': {
+                    uint32_t code = 0;
+                    if (!parseHex4(code)) return false;
+                    if (code >= 0xD800 && code <= 0xDBFF) {
+                        uint32_t low = 0;
+                        if (!consume('\\') || !consume('u') || !parseHex4(low) || low < 0xDC00 || low > 0xDFFF) return false;
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                        return false;
+                    }
+                    putUtf8(code);
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        return false;
+    }
+
+    static constexpr double pow10(int exponent) {
+        double result = 1.0;
+        for (int i = 0; i < exponent; ++i) result *= 10.0;
+        return result;
+    }
+
+    constexpr bool parseNumber(uint32_t keyOffset, uint32_t keyLength) {
+        const size_t start = pos_;
+        const bool negative = consume('-');
+
+        uint64_t mantissa = 0;
+        int significant = 0;
+        int exponent10 = 0;
+        bool overflow = false;   // 정수가 64비트를 넘음
+
+        auto digit = [&](char c, bool fraction) {
+            const uint64_t d = static_cast<uint64_t>(c - '0');
+            if (significant < 19) {
+                if (mantissa || d) {
+                    mantissa = mantissa * 10 + d;
+                    ++significant;
+                }
+                if (fraction) --exponent10;
+            } else {
+                if (!fraction) ++exponent10;
+                overflow = true;
+            }
+        };
+
+        if (pos_ >= length_ || text_[pos_] < '0' || text_[pos_] > '9') return false;
+        if (text_[pos_] == '0') {
+            ++pos_;
+        } else {
+            while (pos_ < length_ && text_[pos_] >= '0' && text_[pos_] <= '9') digit(text_[pos_++], false);
+        }
+
+        bool isInteger = true;
+        if (consume('.')) {
+            isInteger = false;
+            if (pos_ >= length_ || text_[pos_] < '0' || text_[pos_] > '9') return false;
+            while (pos_ < length_ && text_[pos_] >= '0' && text_[pos_] <= '9') digit(text_[pos_++], true);
+        }
+        if (pos_ < length_ && (text_[pos_] == 'e' || text_[pos_] == 'E')) {
+            isInteger = false;
+            ++pos_;
+            const bool expNegative = consume('-');
+            if (!expNegative) consume('+');
+            if (pos_ >= length_ || text_[pos_] < '0' || text_[pos_] > '9') return false;
+            int exp = 0;
+            while (pos_ < length_ && text_[pos_] >= '0' && text_[pos_] <= '9') {
+                if (exp < 100000) exp = exp * 10 + (text_[pos_] - '0');
+                ++pos_;
+            }
+            exponent10 += expNegative ? -exp : exp;
+        }
+
+        // 원문 보관
+        const uint32_t offset = static_cast<uint32_t>(stringCount_);
+        for (size_t i = start; i < pos_; ++i) put(text_[i]);
+
+        StaticType type = StaticType::Double;
+        if (isInteger && !negative && !overflow) {
+            type = mantissa <= static_cast<uint64_t>(INT64_MAX) ? StaticType::Int64 : StaticType::UInt64;
+        } else if (isInteger && negative && !overflow && mantissa <= 9223372036854775808ULL) {
+            type = StaticType::Int64;
+        } else if (isInteger && !negative && overflow && significant == 19 && exponent10 == 1) {
+            // 20자리 정수: uint64 범위 확인
+            const uint64_t last = static_cast<uint64_t>(text_[pos_ - 1] - '0');
+            if (mantissa <= (UINT64_MAX - last) / 10) {
+                mantissa = mantissa * 10 + last;
+                type = StaticType::UInt64;
+            }
+        }
+
+        const uint32_t index = newNode(type, keyOffset, keyLength);
+        setText(index, offset, static_cast<uint32_t>(pos_ - start));
+        if (StaticNode* target = at(index)) {
+            StaticNode& node = *target;
+            if (type == StaticType::Int64) {
+                node.i = negative ? static_cast<int64_t>(0 - mantissa) : static_cast<int64_t>(mantissa);
+            } else if (type == StaticType::UInt64) {
+                node.u = mantissa;
+            }
+            double value = static_cast<double>(mantissa);
+            value = exponent10 < 0 ? value / pow10(-exponent10) : value * pow10(exponent10);
+            node.d = negative ? -value : value;
+        }
+        return true;
+    }
+
+    const char* text_;
+    size_t length_;
+    size_t pos_ = 0;
+    StaticNode* nodes_;
+    size_t nodeCapacity_;
+    char* strings_;
+    size_t nodeCount_ = 0;
+    size_t stringCount_ = 0;
+};
+
+} // namespace detail
+
+/**
+ * @brief 정적 노드 표 안의 값 하나 (읽기 전용 view, constexpr 조회)
+ *
+ * 없는 값(exists() == false)에서의 조회는 모두 기본값
+ */
+class StaticValue {
+public:
+    constexpr StaticValue() = default;
+    constexpr StaticValue(const detail::StaticNode* nodes, const char* strings, uint32_t index)
+        : nodes_(nodes), strings_(strings), index_(index) {}
+
+    constexpr bool exists() const { return nodes_ != nullptr; }
+    constexpr bool isNull() const { return is(detail::StaticType::Null); }
+    constexpr bool isBool() const { return is(detail::StaticType::True) || is(detail::StaticType::False); }
+    constexpr bool isString() const { return is(detail::StaticType::String); }
+    constexpr bool isArray() const { return is(detail::StaticType::Array); }
+    constexpr bool isObject() const { return is(detail::StaticType::Object); }
+    constexpr bool isNumber() const {
+        return is(detail::StaticType::Int64) || is(detail::StaticType::UInt64) || is(detail::StaticType::Double);
+    }
+
+    // 배열 요소 수 / 객체 멤버 수
+    constexpr size_t size() const { return (isArray() || isObject()) ? node().count : 0; }
+
+    /**
+     * @brief 객체 멤버 (같은 이름이 여러 개면 첫 멤버)
+     */
+    constexpr StaticValue operator[](std::string_view key) const {
+        if (!isObject()) return StaticValue();
+        uint32_t child = index_ + 1;
+        for (uint32_t i = 0; i < node().count; ++i) {
+            if (name(nodes_[child]) == key) return StaticValue(nodes_, strings_, child);
+            child = nodes_[child].next;
+        }
+        return StaticValue();
+    }
+
+    /**
+     * @brief 배열 요소 / 객체의 index번째 멤버 값
+     */
+    constexpr StaticValue operator[](size_t index) const {
+        if ((!isArray() && !isObject()) || index >= node().count) return StaticValue();
+        uint32_t child = index_ + 1;
+        for (size_t i = 0; i < index; ++i) child = nodes_[child].next;
+        return StaticValue(nodes_, strings_, child);
+    }
+
+    // 부모 객체에서의 멤버 이름
+    constexpr std::string_view key() const { return exists() ? name(node()) : std::string_view(); }
+
+    constexpr std::string_view asString(std::string_view defaultValue = std::string_view()) const {
+        return isString() ? text() : defaultValue;
+    }
+
+    constexpr bool asBool(bool defaultValue = false) const {
+        return is(detail::StaticType::True) ? true : is(detail::StaticType::False) ? false : defaultValue;
+    }
+
+    constexpr int64_t asInt64(int64_t defaultValue = 0) const {
+        if (is(detail::StaticType::Int64)) return node().i;
+        if (is(detail::StaticType::UInt64)) return static_cast<int64_t>(node().u);
+        if (is(detail::StaticType::Double)) return static_cast<int64_t>(node().d);
+        return defaultValue;
+    }
+
+    constexpr uint64_t asUInt64(uint64_t defaultValue = 0) const {
+        if (is(detail::StaticType::UInt64)) return node().u;
+        if (is(detail::StaticType::Int64)) return node().i >= 0 ? static_cast<uint64_t>(node().i) : defaultValue;
+        return defaultValue;
+    }
+
+    constexpr double asDouble(double defaultValue = 0.0) const {
+        return isNumber() ? node().d : defaultValue;
+    }
+
+    // 숫자 원문 (리터럴에 적힌 그대로)
+    constexpr std::string_view numberText() const { return isNumber() ? text() : std::string_view(); }
+
+    /**
+     * @brief SAX 이벤트로 전달 (숫자는 RawNumber로 원문 전달)
+     */
+    template<typename Handler>
+    inline bool accept(Handler& handler) const {
+        if (!exists()) return handler.Null();
+        const detail::StaticNode& current = node();
+        switch (current.type) {
+            case detail::StaticType::Null: return handler.Null();
+            case detail::StaticType::False: return handler.Bool(false);
+            case detail::StaticType::True: return handler.Bool(true);
+            case detail::StaticType::String:
+                return handler.String(strings_ + current.textOffset, current.textLength, true);
+            case detail::StaticType::Array:
+            case detail::StaticType::Object: {
+                const bool isObj = current.type == detail::StaticType::Object;
+                if (!(isObj ? handler.StartObject() : handler.StartArray())) return false;
+                uint32_t child = index_ + 1;
+                for (uint32_t i = 0; i < current.count; ++i) {
+                    const detail::StaticNode& member = nodes_[child];
+                    if (isObj && !handler.Key(strings_ + member.keyOffset, member.keyLength, true)) return false;
+                    if (!StaticValue(nodes_, strings_, child).accept(handler)) return false;
+                    child = member.next;
+                }
+                return isObj ? handler.EndObject(current.count) : handler.EndArray(current.count);
+            }
+            default:
+                return handler.RawNumber(strings_ + current.textOffset, current.textLength, true);
+        }
+    }
+
+private:
+    constexpr const detail::StaticNode& node() const { return nodes_[index_]; }
+    constexpr bool is(detail::StaticType type) const { return exists() && node().type == type; }
+    constexpr std::string_view text() const { return std::string_view(strings_ + node().textOffset, node().textLength); }
+    constexpr std::string_view name(const detail::StaticNode& target) const {
+        return std::string_view(strings_ + target.keyOffset, target.keyLength);
+    }
+
+    const detail::StaticNode* nodes_ = nullptr;
+    const char* strings_ = nullptr;
+    uint32_t index_ = 0;
+};
+
+/**
+ * @brief 리터럴에 필요한 노드 수 (잘못된 JSON이면 constexpr 평가에서 컴파일 오류)
+ */
+template<size_t Length>
+constexpr size_t staticNodeCount(const char (&text)[Length]) {
+    detail::StaticParser parser(text, Length - 1, nullptr, 0, nullptr);
+    if (!parser.parse()) {
+        detail::invalidJsonLiteral();
+        return 1;
+    }
+    return parser.nodeCount();
+}
+
+/**
+ * @brief 컴파일 타임 파싱 JSON document
+ *
+ * @code
+ * constexpr auto kDefaults = JSONABLE_JSON_LITERAL(R"({
+ *     "port": 8080,
+ *     "hosts": ["a.internal", "b.internal"],
+ *     "retry": {"count": 3, "backoff": 0.25}
+ * })");
+ * static_assert(kDefaults.getInt64("port") == 8080);
+ *
+ * Config config;
+ * kDefaults.load(config);            // 텍스트 파싱 없이 loadFromJson() 호출
+ * kDefaults["retry"]["backoff"].asDouble();
+ * @endcode
+ *
+ * getter는 JsonableBase와 같은 이름/기본값 규칙 (문자열은 string_view 반환)
+ */
+template<size_t Nodes, size_t Length>
+class StaticJson {
+public:
+    constexpr explicit StaticJson(const char (&text)[Length]) {
+        detail::StaticParser parser(text, Length - 1, nodes_, Nodes, strings_);
+        valid_ = parser.parse() && parser.nodeCount() == Nodes;
+        if (!valid_) detail::invalidJsonLiteral();
+    }
+
+    constexpr bool valid() const { return valid_; }
+    constexpr StaticValue root() const { return valid_ ? StaticValue(nodes_, strings_, 0) : StaticValue(); }
+    constexpr StaticValue operator[](std::string_view key) const { return root()[key]; }
+
+    // ========================================
+    // 루트 멤버 getter (JsonableBase와 동일한 규칙)
+    // ========================================
+
+    constexpr bool hasKey(std::string_view key) const { return root()[key].exists(); }
+
+    constexpr std::string_view getString(std::string_view key, std::string_view defaultValue = "") const {
+        return root()[key].asString(defaultValue);
+    }
+    constexpr int64_t getInt64(std::string_view key, int64_t defaultValue = 0) const {
+        return root()[key].asInt64(defaultValue);
+    }
+    constexpr uint64_t getUInt64(std::string_view key, uint64_t defaultValue = 0) const {
+        return root()[key].asUInt64(defaultValue);
+    }
+    constexpr double getDouble(std::string_view key, double defaultValue = 0.0) const {
+        return root()[key].asDouble(defaultValue);
+    }
+    constexpr bool getBool(std::string_view key, bool defaultValue = false) const {
+        return root()[key].asBool(defaultValue);
+    }
+
+    // ========================================
+    // 런타임 변환
+    // ========================================
+
+    /**
+     * @brief Jsonable 객체로 로드 (JSON 텍스트 파싱 없이 SAX 이벤트 직결)
+     */
+    inline void load(FromJsonable& object) const {
+        object.fromEvents([this](auto& handler) { return root().accept(handler); });
+    }
+
+    inline std::string toJson() const {
+        rapidjson::StringBuffer buffer;
+        detail::JsonWriter<rapidjson::StringBuffer> writer(buffer);
+        root().accept(writer);
+        return std::string(buffer.GetString(), buffer.GetSize());
+    }
+
+    template<typename Handler>
+    inline bool accept(Handler& handler) const { return root().accept(handler); }
+
+private:
+    detail::StaticNode nodes_[Nodes] = {};
+    char strings_[Length] = {};
+    bool valid_ = false;
+};
+
+template<size_t Nodes, size_t Length>
+constexpr StaticJson<Nodes, Length> fromLiteral(const char (&text)[Length]) {
+    return StaticJson<Nodes, Length>(text);
+}
+
+} // namespace json
+
+/**
+ * @brief 문자열 리터럴 → constexpr StaticJson (노드 수 자동 계산)
+ */
+#define JSONABLE_JSON_LITERAL(literal) ::json::fromLiteral<::json::staticNodeCount(literal)>(literal)
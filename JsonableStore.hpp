@@ -0,0 +1,584 @@
+#pragma once
+
+/**
+ * JsonableStore.hpp - 내장 append-only 레코드 저장소 (완전 inline, POSIX 전용)
+ *
+ * 역할: Jsonable 레코드를 id 키로 파일에 덧붙여 저장
+ *       - 쓰기: 프레임(헤더 + JSON) 한 번의 pwrite
+ *       - 읽기: 메모리 id → 오프셋 색인으로 O(1) 조회 후 pread 한 번
+ *       - 재시작: 저장해 둔 색인 파일 + 이후 덧붙은 꼬리만 mmap으로 훑어 복원
+ *       - 압축: 살아 있는 레코드만 새 파일로 복사 (백그라운드 스레드 가능)
+ *
+ * 파일:
+ * - <path>      : 레코드 프레임 (RecordHeader 24바이트 + JSON + 8바이트 정렬 패딩)
+ * - <path>.idx  : 색인 스냅샷 (데이터 파일 inode/크기 + (id, 오프셋, 프레임 크기) 목록)
+ */
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define JSONABLE_HAS_STORE 1
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ToJsonable.hpp"
+#include "FromJsonable.hpp"
+
+namespace json {
+namespace detail {
+
+constexpr uint32_t kRecordMagic = 0x4A524543;      // "JREC"
+constexpr uint32_t kStoreIndexMagic = 0x4A524958;  // "JRIX"
+constexpr uint32_t kStoreIndexVersion = 1;
+constexpr uint32_t kRecordTombstone = 1;
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t length;     // JSON 바이트 수 (패딩 제외)
+    uint64_t id;
+    uint32_t checksum;   // FNV-1a (id + JSON)
+    uint32_t flags;      // kRecordTombstone: 삭제 표시
+};
+
+struct StoreIndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t dataInode;
+    uint64_t dataSize;   // 이 스냅샷이 반영한 데이터 파일 길이
+    uint64_t count;
+};
+
+struct StoreIndexEntry {
+    uint64_t id;
+    uint64_t offset;
+    uint64_t frameSize;
+};
+
+static_assert(sizeof(RecordHeader) == 24, "RecordHeader layout must be 24 bytes");
+
+inline size_t recordFrameSize(size_t length) {
+    return (sizeof(RecordHeader) + length + 7) & ~size_t(7);
+}
+
+inline uint32_t recordChecksum(uint64_t id, const char* data, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < 8; ++i) {
+        hash ^= static_cast<uint8_t>(id >> (i * 8));
+        hash *= 16777619u;
+    }
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+inline bool writeAll(int fd, const char* data, size_t size, uint64_t offset) {
+    while (size > 0) {
+        const ssize_t n = ::pwrite(fd, data, size, static_cast<off_t>(offset));
+        if (n <= 0) return false;
+        data += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+inline bool readAll(int fd, char* data, size_t size, uint64_t offset) {
+    while (size > 0) {
+        const ssize_t n = ::pread(fd, data, size, static_cast<off_t>(offset));
+        if (n <= 0) return false;
+        data += n;
+        size -= static_cast<size_t>(n);
+        offset += static_cast<uint64_t>(n);
+    }
+    return true;
+}
+
+} // namespace detail
+
+/**
+ * @brief id 키 append-only 레코드 저장소
+ *
+ * @code
+ * json::RecordStore store;
+ * store.open("/var/lib/app/users.jrec");   // 색인 + 꼬리 스캔으로 복원
+ *
+ * store.put(user.id, user);                // 같은 id면 새 레코드가 이전 것을 대체
+ * User loaded;
+ * store.get(42, loaded);                   // O(1) 조회 + pread 한 번
+ * store.remove(7);                         // 삭제 표시 레코드 추가
+ *
+ * if (store.garbageRatio() > 0.5) store.compactAsync();
+ * store.close();                           // 색인 저장
+ * @endcode
+ *
+ * 모든 메서드는 스레드 안전함, 압축 중에도 put/get/remove 가능
+ */
+class RecordStore {
+public:
+    RecordStore() = default;
+    ~RecordStore() { close(); }
+
+    RecordStore(const RecordStore&) = delete;
+    RecordStore& operator=(const RecordStore&) = delete;
+
+    // ========================================
+    // 열기/닫기
+    // ========================================
+
+    /**
+     * @brief 저장소 열기 (없으면 생성)
+     *
+     * 색인 파일이 데이터 파일과 맞으면 색인을 읽고 그 뒤 꼬리만 스캔,
+     * 아니면 데이터 전체를 스캔. 손상된 꼬리(쓰기 중 중단)는 잘라냄
+     */
+    inline bool open(const std::string& path) {
+        close();
+        std::unique_lock<std::mutex> lock(mutex_);
+        waitIdle(lock);
+
+        const int fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) return false;
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        path_ = path;
+        fd_ = fd;
+        dataSize_ = 0;
+        liveBytes_ = 0;
+        index_.clear();
+
+        const uint64_t fileSize = static_cast<uint64_t>(info.st_size);
+        const uint64_t scanFrom = loadIndex(static_cast<uint64_t>(info.st_ino), fileSize);
+        if (!restore(scanFrom, fileSize)) {
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 진행 중인 압축을 기다린 뒤 색인 저장 후 닫기
+     */
+    inline void close() {
+        joinCompaction();
+        std::unique_lock<std::mutex> lock(mutex_);
+        waitIdle(lock);   // 다른 스레드의 동기 compact()
+        if (fd_ < 0) return;
+        ::fsync(fd_);
+        saveIndex();
+        ::close(fd_);
+        fd_ = -1;
+        index_.clear();
+        dataSize_ = 0;
+        liveBytes_ = 0;
+    }
+
+    inline bool isOpen() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return fd_ >= 0;
+    }
+
+    /**
+     * @brief 데이터 fsync + 색인 스냅샷 저장 (다음 재시작은 이후 꼬리만 스캔)
+     */
+    inline bool flush() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (fd_ < 0) return false;
+        return ::fsync(fd_) == 0 && saveIndex();
+    }
+
+    // ========================================
+    // 레코드 접근
+    // ========================================
+
+    /**
+     * @brief 레코드 저장 (같은 id의 이전 레코드는 쓰레기가 됨)
+     */
+    inline bool put(uint64_t id, const ToJsonable& record) {
+        const std::string jsonStr = record.toJson();
+        return append(id, jsonStr.data(), jsonStr.size(), 0);
+    }
+
+    /**
+     * @brief 이미 직렬화된 JSON 저장
+     */
+    inline bool putJson(uint64_t id, const std::string& jsonStr) {
+        return append(id, jsonStr.data(), jsonStr.size(), 0);
+    }
+
+    /**
+     * @brief 레코드 읽기
+     *
+     * @return id가 없거나 프레임이 손상(체크섬 불일치 포함)되었으면 false (record 변경 없음)
+     */
+    inline bool get(uint64_t id, FromJsonable& record) const {
+        std::string jsonStr;
+        if (!getJson(id, jsonStr)) return false;
+        record.fromJson(jsonStr);
+        return true;
+    }
+
+    inline bool getJson(uint64_t id, std::string& jsonStr) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = index_.find(id);
+        if (fd_ < 0 || it == index_.end()) return false;
+
+        std::string frame(it->second.frameSize, '\0');
+        if (!detail::readAll(fd_, &frame[0], frame.size(), it->second.offset)) return false;
+        detail::RecordHeader header;
+        std::memcpy(&header, frame.data(), sizeof(header));
+        const char* data = frame.data() + sizeof(header);
+        if (header.magic != detail::kRecordMagic || header.id != id ||
+            detail::recordFrameSize(header.length) != frame.size() ||
+            header.checksum != detail::recordChecksum(id, data, header.length)) {
+            return false;
+        }
+        jsonStr.assign(data, header.length);
+        return true;
+    }
+
+    /**
+     * @brief 삭제 (삭제 표시 레코드를 덧붙임)
+     */
+    inline bool remove(uint64_t id) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (index_.find(id) == index_.end()) return false;
+        }
+        return append(id, nullptr, 0, detail::kRecordTombstone);
+    }
+
+    inline bool contains(uint64_t id) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return index_.find(id) != index_.end();
+    }
+
+    inline size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return index_.size();
+    }
+
+    inline std::vector<uint64_t> ids() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<uint64_t> result;
+        result.reserve(index_.size());
+        for (const auto& entry : index_) result.push_back(entry.first);
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // ========================================
+    // 압축
+    // ========================================
+
+    inline uint64_t fileSize() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dataSize_;
+    }
+
+    // 덮어쓰기/삭제로 죽은 바이트 비율 (0 ~ 1)
+    inline double garbageRatio() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dataSize_ ? static_cast<double>(dataSize_ - liveBytes_) / static_cast<double>(dataSize_) : 0.0;
+    }
+
+    /**
+     * @brief 살아 있는 레코드만 새 파일로 복사 후 원자적으로 교체
+     *
+     * 복사는 잠금 없이 진행 (그동안의 쓰기는 끝에서 꼬리로 이어 붙임)
+     */
+    inline bool compact() {
+        if (!beginCompaction()) return false;
+        const bool ok = compactNow();
+        endCompaction();
+        return ok;
+    }
+
+    /**
+     * @brief 백그라운드 스레드에서 압축 (이미 진행 중이거나 닫혀 있으면 false)
+     */
+    inline bool compactAsync() {
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        if (!beginCompaction()) return false;
+        if (compactionThread_.joinable()) compactionThread_.join();
+        compactionThread_ = std::thread([this] {
+            compactNow();
+            endCompaction();
+        });
+        return true;
+    }
+
+    inline void waitForCompaction() { joinCompaction(); }
+
+private:
+    struct Location {
+        uint64_t offset;
+        uint64_t frameSize;
+    };
+
+    inline std::string indexPath() const { return path_ + ".idx"; }
+
+    inline void joinCompaction() {
+        std::lock_guard<std::mutex> lock(threadMutex_);
+        if (compactionThread_.joinable()) compactionThread_.join();
+    }
+
+    // 열린 상태에서 다른 압축이 없을 때만 압축 시작 표시
+    inline bool beginCompaction() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (fd_ < 0 || compacting_) return false;
+        compacting_ = true;
+        return true;
+    }
+
+    inline void endCompaction() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        compacting_ = false;
+        compactionDone_.notify_all();
+    }
+
+    // 압축이 끝날 때까지 대기 (압축은 잠금 밖에서 fd_/path_를 쓰므로 닫기/다시 열기 전에 호출)
+    inline void waitIdle(std::unique_lock<std::mutex>& lock) {
+        compactionDone_.wait(lock, [this] { return !compacting_; });
+    }
+
+    inline bool append(uint64_t id, const char* data, size_t length, uint32_t flags) {
+        const size_t frameSize = detail::recordFrameSize(length);
+        std::string frame(frameSize, '\0');
+        detail::RecordHeader header{detail::kRecordMagic, static_cast<uint32_t>(length), id,
+                                    detail::recordChecksum(id, data, length), flags};
+        std::memcpy(&frame[0], &header, sizeof(header));
+        if (length) std::memcpy(&frame[sizeof(header)], data, length);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (fd_ < 0 || !detail::writeAll(fd_, frame.data(), frame.size(), dataSize_)) return false;
+        apply(id, flags, dataSize_, frameSize);
+        dataSize_ += frameSize;
+        return true;
+    }
+
+    // 레코드 하나를 색인에 반영
+    inline void apply(uint64_t id, uint32_t flags, uint64_t offset, uint64_t frameSize) {
+        const auto it = index_.find(id);
+        if (it != index_.end()) {
+            liveBytes_ -= it->second.frameSize;
+            if (flags & detail::kRecordTombstone) {
+                index_.erase(it);
+                return;
+            }
+            it->second = Location{offset, frameSize};
+        } else if (flags & detail::kRecordTombstone) {
+            return;
+        } else {
+            index_.emplace(id, Location{offset, frameSize});
+        }
+        liveBytes_ += frameSize;
+    }
+
+    /**
+     * @brief 색인 스냅샷 읽기
+     *
+     * @return 스캔을 시작할 데이터 오프셋 (색인이 없거나 맞지 않으면 0)
+     */
+    inline uint64_t loadIndex(uint64_t inode, uint64_t fileSize) {
+        const int fd = ::open(indexPath().c_str(), O_RDONLY);
+        if (fd < 0) return 0;
+
+        struct stat info;
+        uint64_t scanFrom = 0;
+        if (::fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= sizeof(detail::StoreIndexHeader)) {
+            const size_t size = static_cast<size_t>(info.st_size);
+            void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                const char* base = static_cast<const char*>(address);
+                detail::StoreIndexHeader header;
+                std::memcpy(&header, base, sizeof(header));
+                const bool valid = header.magic == detail::kStoreIndexMagic &&
+                                   header.version == detail::kStoreIndexVersion &&
+                                   header.dataInode == inode && header.dataSize <= fileSize &&
+                                   size == sizeof(header) + header.count * sizeof(detail::StoreIndexEntry);
+                if (valid) {
+                    index_.reserve(header.count);
+                    const char* cursor = base + sizeof(header);
+                    for (uint64_t i = 0; i < header.count; ++i, cursor += sizeof(detail::StoreIndexEntry)) {
+                        detail::StoreIndexEntry entry;
+                        std::memcpy(&entry, cursor, sizeof(entry));
+                        index_[entry.id] = Location{entry.offset, entry.frameSize};
+                        liveBytes_ += entry.frameSize;
+                    }
+                    scanFrom = header.dataSize;
+                }
+                ::munmap(address, size);
+            }
+        }
+        ::close(fd);
+        return scanFrom;
+    }
+
+    /**
+     * @brief 데이터 파일 [from, fileSize)를 mmap으로 훑어 색인 갱신, 손상된 꼬리는 잘라냄
+     */
+    inline bool restore(uint64_t from, uint64_t fileSize) {
+        dataSize_ = from;
+        if (from < fileSize) {
+            void* address = ::mmap(nullptr, static_cast<size_t>(fileSize), PROT_READ, MAP_SHARED, fd_, 0);
+            if (address == MAP_FAILED) return false;
+            const char* base = static_cast<const char*>(address);
+
+            uint64_t offset = from;
+            while (fileSize - offset >= sizeof(detail::RecordHeader)) {
+                detail::RecordHeader header;
+                std::memcpy(&header, base + offset, sizeof(header));
+                const uint64_t frameSize = detail::recordFrameSize(header.length);
+                if (header.magic != detail::kRecordMagic || frameSize > fileSize - offset ||
+                    header.checksum != detail::recordChecksum(header.id, base + offset + sizeof(header), header.length)) {
+                    break;
+                }
+                apply(header.id, header.flags, offset, frameSize);
+                offset += frameSize;
+            }
+            ::munmap(address, static_cast<size_t>(fileSize));
+            dataSize_ = offset;
+        }
+        if (dataSize_ < fileSize && ::ftruncate(fd_, static_cast<off_t>(dataSize_)) != 0) return false;
+        return true;
+    }
+
+    // 색인 스냅샷을 임시 파일에 쓴 뒤 rename (mutex_ 보유 상태에서 호출)
+    inline bool saveIndex() {
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) return false;
+
+        std::string buffer(sizeof(detail::StoreIndexHeader) + index_.size() * sizeof(detail::StoreIndexEntry), '\0');
+        detail::StoreIndexHeader header{detail::kStoreIndexMagic, detail::kStoreIndexVersion,
+                                        static_cast<uint64_t>(info.st_ino), dataSize_, index_.size()};
+        std::memcpy(&buffer[0], &header, sizeof(header));
+        char* cursor = &buffer[sizeof(header)];
+        for (const auto& item : index_) {
+            const detail::StoreIndexEntry entry{item.first, item.second.offset, item.second.frameSize};
+            std::memcpy(cursor, &entry, sizeof(entry));
+            cursor += sizeof(entry);
+        }
+
+        const std::string temporary = indexPath() + ".tmp";
+        const int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) return false;
+        const bool ok = detail::writeAll(fd, buffer.data(), buffer.size(), 0) && ::fsync(fd) == 0;
+        ::close(fd);
+        if (!ok || std::rename(temporary.c_str(), indexPath().c_str()) != 0) {
+            ::unlink(temporary.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    inline bool copyRange(int from, uint64_t fromOffset, int to, uint64_t toOffset, uint64_t size) const {
+        std::vector<char> chunk(static_cast<size_t>(std::min<uint64_t>(size, 1 << 20)));
+        while (size > 0) {
+            const size_t n = static_cast<size_t>(std::min<uint64_t>(size, chunk.size()));
+            if (!detail::readAll(from, chunk.data(), n, fromOffset) ||
+                !detail::writeAll(to, chunk.data(), n, toOffset)) {
+                return false;
+            }
+            fromOffset += n;
+            toOffset += n;
+            size -= n;
+        }
+        return true;
+    }
+
+    inline bool compactNow() {
+        // 1. 스냅샷 (살아 있는 레코드 위치와 현재 끝)
+        std::vector<std::pair<uint64_t, Location>> live;
+        uint64_t snapshotEnd;
+        int source;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (fd_ < 0) return false;
+            live.assign(index_.begin(), index_.end());
+            snapshotEnd = dataSize_;
+            source = fd_;   // 압축 중에는 close/open이 대기하므로 잠금 밖에서 읽어도 유효
+        }
+        std::sort(live.begin(), live.end(),
+                  [](const auto& a, const auto& b) { return a.second.offset < b.second.offset; });
+
+        // 2. 잠금 없이 살아 있는 레코드 복사 (파일 순서 유지)
+        const std::string temporary = path_ + ".compact";
+        const int target = ::open(temporary.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (target < 0) return false;
+
+        std::unordered_map<uint64_t, uint64_t> moved;
+        moved.reserve(live.size());
+        uint64_t written = 0;
+        bool ok = true;
+        for (const auto& item : live) {
+            if (!copyRange(source, item.second.offset, target, written, item.second.frameSize)) {
+                ok = false;
+                break;
+            }
+            moved.emplace(item.second.offset, written);
+            written += item.second.frameSize;
+        }
+
+        // 3. 잠금 후 그동안 덧붙은 꼬리를 이어 붙이고 교체
+        std::lock_guard<std::mutex> lock(mutex_);
+        const uint64_t tail = dataSize_ - snapshotEnd;
+        ok = ok && copyRange(source, snapshotEnd, target, written, tail) && ::fsync(target) == 0 &&
+             std::rename(temporary.c_str(), path_.c_str()) == 0;
+        if (!ok) {
+            ::close(target);
+            ::unlink(temporary.c_str());
+            return false;
+        }
+
+        uint64_t liveBytes = 0;
+        for (auto& item : index_) {
+            Location& location = item.second;
+            location.offset = location.offset < snapshotEnd ? moved[location.offset]
+                                                            : location.offset - snapshotEnd + written;
+            liveBytes += location.frameSize;
+        }
+        ::close(fd_);
+        fd_ = target;
+        dataSize_ = written + tail;
+        liveBytes_ = liveBytes;
+        saveIndex();
+        return true;
+    }
+
+    mutable std::mutex mutex_;
+    std::string path_;
+    int fd_ = -1;
+    uint64_t dataSize_ = 0;
+    uint64_t liveBytes_ = 0;
+    std::unordered_map<uint64_t, Location> index_;
+
+    bool compacting_ = false;   // mutex_로 보호
+    std::condition_variable compactionDone_;
+    std::mutex threadMutex_;
+    std::thread compactionThread_;
+};
+
+} // namespace json
+
+#endif // __unix__ || __APPLE__
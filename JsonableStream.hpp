@@ -0,0 +1,276 @@
+#pragma once
+
+/**
+ * JsonableStream.hpp - document 없는 스트림 변환 (완전 inline)
+ *
+ * 역할: SAX Reader → Writer 직결로 형태만 바꾸는 변환을 고정 메모리로 수행
+ *       - compact ↔ pretty
+ *       - 최상위 배열 → NDJSON (한 줄에 요소 하나)
+ *       - NDJSON → 최상위 배열
+ */
+
+#include <istream>
+#include <ostream>
+#include <memory>
+#include <cstddef>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/reader.h>
+#include <rapidjson/writer.h>
+#include <rapidjson/prettywriter.h>
+
+namespace json {
+namespace detail {
+
+// 스트림 버퍼 크기 (입력/출력 각각 고정, 힙에 한 번 할당 → 변환 하나에 128 KiB, 호출 스택은 거의 쓰지 않음)
+constexpr size_t kStreamBufferSize = 64 * 1024;
+
+/**
+ * @brief 고정 버퍼 입력 스트림 (RapidJSON InputStream 개념)
+ *
+ * std::istream을 블록 단위로 읽어 문자 단위 가상 호출을 피함, 끝에서는 '\0'
+ */
+class BufferedIStream {
+public:
+    typedef char Ch;
+
+    explicit BufferedIStream(std::istream& stream)
+        : stream_(stream), buffer_(new char[kStreamBufferSize]), current_(buffer_.get()), end_(buffer_.get()) {
+        refill();
+    }
+
+    inline Ch Peek() const { return current_ < end_ ? *current_ : '\0'; }
+
+    inline Ch Take() {
+        if (current_ >= end_) return '\0';
+        const Ch c = *current_++;
+        if (current_ == end_) refill();
+        return c;
+    }
+
+    inline size_t Tell() const { return consumed_ + static_cast<size_t>(current_ - buffer_.get()); }
+
+    // 출력 관련 멤버는 Reader가 호출하지 않음
+    Ch* PutBegin() { return nullptr; }
+    void Put(Ch) {}
+    void Flush() {}
+    size_t PutEnd(Ch*) { return 0; }
+
+private:
+    inline void refill() {
+        consumed_ += static_cast<size_t>(end_ - buffer_.get());
+        stream_.read(buffer_.get(), static_cast<std::streamsize>(kStreamBufferSize));
+        current_ = buffer_.get();
+        end_ = buffer_.get() + stream_.gcount();
+    }
+
+    std::istream& stream_;
+    std::unique_ptr<char[]> buffer_;
+    char* current_;
+    char* end_;
+    size_t consumed_ = 0;
+};
+
+/**
+ * @brief 고정 버퍼 출력 스트림 (RapidJSON OutputStream 개념)
+ *
+ * 쓰기 실패는 std::ostream 상태로 남으므로 끝에서 finish()로 확인
+ */
+class BufferedOStream {
+public:
+    typedef char Ch;
+
+    explicit BufferedOStream(std::ostream& stream) : stream_(stream), buffer_(new char[kStreamBufferSize]) {}
+    ~BufferedOStream() {
+        drain();
+        stream_.flush();
+    }
+
+    BufferedOStream(const BufferedOStream&) = delete;
+    BufferedOStream& operator=(const BufferedOStream&) = delete;
+
+    inline void Put(Ch c) {
+        if (size_ == kStreamBufferSize) drain();
+        buffer_[size_++] = c;
+    }
+
+    // Writer가 루트 값마다 호출하므로 줄 단위 write를 피하기 위해 비워 둠 (finish/소멸 시 일괄 기록)
+    inline void Flush() {}
+
+    /**
+     * @brief 남은 버퍼 기록 + flush
+     *
+     * @return 지금까지의 쓰기가 모두 성공했으면 true
+     */
+    inline bool finish() {
+        drain();
+        stream_.flush();
+        return !stream_.fail();
+    }
+
+private:
+    inline void drain() {
+        if (size_ > 0) {
+            stream_.write(buffer_.get(), static_cast<std::streamsize>(size_));
+            size_ = 0;
+        }
+    }
+
+    std::ostream& stream_;
+    std::unique_ptr<char[]> buffer_;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief 최상위 배열의 각 요소를 독립 JSON 줄로 출력하는 SAX 핸들러
+ */
+template<typename Writer, typename OutputStream>
+class NdjsonSplitHandler {
+public:
+    NdjsonSplitHandler(Writer& writer, OutputStream& out) : writer_(writer), out_(out) {}
+
+    bool Null() { return scalar([this] { return writer_.Null(); }); }
+    bool Bool(bool b) { return scalar([&] { return writer_.Bool(b); }); }
+    bool Int(int i) { return scalar([&] { return writer_.Int(i); }); }
+    bool Uint(unsigned u) { return scalar([&] { return writer_.Uint(u); }); }
+    bool Int64(int64_t i) { return scalar([&] { return writer_.Int64(i); }); }
+    bool Uint64(uint64_t u) { return scalar([&] { return writer_.Uint64(u); }); }
+    bool Double(double d) { return scalar([&] { return writer_.Double(d); }); }
+    bool RawNumber(const char* str, rapidjson::SizeType length, bool copy) {
+        return scalar([&] { return writer_.RawNumber(str, length, copy); });
+    }
+    bool String(const char* str, rapidjson::SizeType length, bool copy) {
+        return scalar([&] { return writer_.String(str, length, copy); });
+    }
+    bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+        return writer_.Key(str, length, copy);
+    }
+
+    bool StartObject() {
+        if (depth_ == 0) return false;   // 루트는 배열이어야 함
+        beginElement();
+        ++depth_;
+        return writer_.StartObject();
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount) {
+        --depth_;
+        return writer_.EndObject(memberCount) && endElement();
+    }
+
+    bool StartArray() {
+        if (depth_ == 0) {
+            depth_ = 1;                  // 루트 배열 자체는 출력하지 않음
+            return true;
+        }
+        beginElement();
+        ++depth_;
+        return writer_.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount) {
+        if (--depth_ == 0) return true;
+        return writer_.EndArray(elementCount) && endElement();
+    }
+
+private:
+    template<typename Emit>
+    inline bool scalar(Emit&& emit) {
+        if (depth_ == 0) return false;
+        beginElement();
+        return emit() && endElement();
+    }
+
+    // 루트 배열 직속 요소 시작: 새 루트로 출력 (쉼표 없음)
+    inline void beginElement() {
+        if (depth_ == 1) writer_.Reset(out_);
+    }
+
+    inline bool endElement() {
+        if (depth_ == 1) out_.Put('\n');
+        return true;
+    }
+
+    Writer& writer_;
+    OutputStream& out_;
+    int depth_ = 0;
+};
+
+/**
+ * @brief 입력 전체를 하나의 JSON 값으로 읽어 Writer로 재출력
+ */
+template<typename Writer>
+inline bool transcode(std::istream& in, Writer& writer) {
+    BufferedIStream input(in);
+    rapidjson::Reader reader;
+    // 숫자는 원문 그대로 전달 (정밀도/표기 보존)
+    return !reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(input, writer).IsError();
+}
+
+} // namespace detail
+
+// ========================================
+// 공개 API (입력 오류나 출력 스트림 쓰기 실패 시 false, 그때까지의 출력은 남음)
+// ========================================
+
+/**
+ * @brief JSON → 공백 없는 compact JSON
+ */
+inline bool compactStream(std::istream& in, std::ostream& out) {
+    detail::BufferedOStream output(out);
+    rapidjson::Writer<detail::BufferedOStream> writer(output);
+    return detail::transcode(in, writer) && output.finish();
+}
+
+/**
+ * @brief JSON → 들여쓰기된 pretty JSON
+ *
+ * @param indent 단계별 들여쓰기 공백 수
+ */
+inline bool prettyStream(std::istream& in, std::ostream& out, unsigned indent = 4) {
+    detail::BufferedOStream output(out);
+    rapidjson::PrettyWriter<detail::BufferedOStream> writer(output);
+    writer.SetIndent(' ', indent);
+    return detail::transcode(in, writer) && output.finish();
+}
+
+/**
+ * @brief 최상위 배열 → NDJSON (요소마다 compact JSON 한 줄)
+ *
+ * 루트가 배열이 아니면 false
+ */
+inline bool arrayToNdjson(std::istream& in, std::ostream& out) {
+    detail::BufferedIStream input(in);
+    detail::BufferedOStream output(out);
+    rapidjson::Writer<detail::BufferedOStream> writer(output);
+    detail::NdjsonSplitHandler<rapidjson::Writer<detail::BufferedOStream>, detail::BufferedOStream> handler(writer, output);
+
+    rapidjson::Reader reader;
+    return !reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(input, handler).IsError() && output.finish();
+}
+
+/**
+ * @brief NDJSON → 최상위 배열 (빈 줄은 무시, 빈 입력은 [])
+ *
+ * 한 줄에 값이 둘 이상이면 false (값 뒤에는 공백과 줄바꿈만 허용)
+ */
+inline bool ndjsonToArray(std::istream& in, std::ostream& out) {
+    detail::BufferedIStream input(in);
+    detail::BufferedOStream output(out);
+    rapidjson::Writer<detail::BufferedOStream> writer(output);
+    rapidjson::Reader reader;
+
+    writer.StartArray();
+    for (;;) {
+        rapidjson::SkipWhitespace(input);
+        if (input.Peek() == '\0') break;
+        // 줄마다 값 하나만 읽고 멈춤, 요소는 열린 배열 안에 이어서 출력
+        constexpr unsigned flags = rapidjson::kParseNumbersAsStringsFlag | rapidjson::kParseStopWhenDoneFlag;
+        if (reader.Parse<flags>(input, writer).IsError()) return false;
+        while (input.Peek() == ' ' || input.Peek() == '\t' || input.Peek() == '\r') input.Take();
+        if (input.Peek() != '\n' && input.Peek() != '\0') return false;
+    }
+    return writer.EndArray() && output.finish();
+}
+
+} // namespace json
@@ -0,0 +1,123 @@
+#pragma once
+
+/**
+ * JsonableUuid.hpp - 16바이트 UUID 값 타입과 텍스트 변환 (완전 inline)
+ *
+ * 역할: "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" 형식 ↔ std::array<uint8_t, 16>
+ *       (분기 없는 hex 변환, 검증 포함 파싱)
+ */
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace json {
+
+/**
+ * @brief UUID 바이트 (RFC 4122 바이트 순서 그대로)
+ */
+using Uuid = std::array<uint8_t, 16>;
+
+namespace detail {
+
+// 텍스트 형식 길이 (하이픈 4개 포함)
+constexpr size_t kUuidTextLength = 36;
+
+// 바이트 i 앞에 하이픈이 오는지 (4, 6, 8, 10번째 바이트 앞)
+constexpr bool uuidDashBefore(size_t byteIndex) {
+    return byteIndex == 4 || byteIndex == 6 || byteIndex == 8 || byteIndex == 10;
+}
+
+/**
+ * @brief nibble(0..15) → 소문자 hex 문자 (분기 없음)
+ *
+ * n > 9 이면 (9 - n)의 부호 비트가 서서 'a' - '0' - 10 = 39를 더함
+ */
+inline char hexDigit(unsigned nibble) {
+    const int n = static_cast<int>(nibble);
+    return static_cast<char>('0' + n + (((9 - n) >> 31) & 39));
+}
+
+/**
+ * @brief hex 문자 → nibble 표 (잘못된 문자는 0xFF)
+ */
+struct HexTable {
+    uint8_t values[256];
+
+    constexpr HexTable() : values() {
+        for (int i = 0; i < 256; ++i) values[i] = 0xFF;
+        for (int i = 0; i < 10; ++i) values['0' + i] = static_cast<uint8_t>(i);
+        for (int i = 0; i < 6; ++i) {
+            values['a' + i] = static_cast<uint8_t>(10 + i);
+            values['A' + i] = static_cast<uint8_t>(10 + i);
+        }
+    }
+};
+
+inline constexpr HexTable kHexTable{};
+
+/**
+ * @brief UUID → 36자 텍스트 (out에 종료 문자 없이 기록)
+ */
+inline void formatUuid(const Uuid& uuid, char* out) {
+    char* p = out;
+    for (size_t i = 0; i < uuid.size(); ++i) {
+        if (uuidDashBefore(i)) *p++ = '-';
+        *p++ = hexDigit(uuid[i] >> 4);
+        *p++ = hexDigit(uuid[i] & 0x0F);
+    }
+}
+
+/**
+ * @brief 36자 텍스트 → UUID (대소문자 허용, 하이픈 위치 검증)
+ *
+ * 잘못된 문자는 누적 OR로 모아 마지막에 한 번만 판정
+ * @return 형식이 맞지 않으면 false (out 변경 없음)
+ */
+inline bool parseUuid(const char* text, size_t length, Uuid& out) {
+    if (length != kUuidTextLength) return false;
+    if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-') return false;
+
+    Uuid result;
+    uint8_t invalid = 0;
+    const char* p = text;
+    for (size_t i = 0; i < result.size(); ++i) {
+        if (uuidDashBefore(i)) ++p;
+        const uint8_t high = kHexTable.values[static_cast<uint8_t>(p[0])];
+        const uint8_t low = kHexTable.values[static_cast<uint8_t>(p[1])];
+        invalid |= static_cast<uint8_t>(high | low);
+        result[i] = static_cast<uint8_t>((high << 4) | (low & 0x0F));
+        p += 2;
+    }
+    // 유효한 nibble은 0..15 이므로 상위 비트가 서면 잘못된 문자
+    if (invalid & 0xF0) return false;
+
+    out = result;
+    return true;
+}
+
+} // namespace detail
+
+// ========================================
+// 공개 헬퍼
+// ========================================
+
+/**
+ * @brief UUID → 소문자 36자 문자열
+ */
+inline std::string uuidToString(const Uuid& uuid) {
+    std::string text(detail::kUuidTextLength, '\0');
+    detail::formatUuid(uuid, &text[0]);
+    return text;
+}
+
+/**
+ * @brief 36자 문자열 → UUID (형식이 맞지 않으면 false, out 유지)
+ */
+inline bool parseUuid(std::string_view text, Uuid& out) {
+    return detail::parseUuid(text.data(), text.size(), out);
+}
+
+} // namespace json
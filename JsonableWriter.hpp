@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * JsonableWriter.hpp - 정수 출력 경로를 교체한 Writer (완전 inline)
+ *
+ * 역할: rapidjson::Writer의 Int/Uint/Int64/Uint64만 가려서
+ *       자릿수를 먼저 구하고 출력 버퍼에 정확한 길이로 바로 기록
+ *       (나머지 값/구조 출력은 기본 Writer 그대로)
+ */
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// RapidJSON 헤더들 (사용자에게 숨겨짐)
+#include <rapidjson/writer.h>
+
+#include "JsonableNumber.hpp"
+
+namespace json {
+namespace detail {
+
+// 출력 스트림이 Push(count)로 연속 영역을 내주는지 (StringBuffer 등)
+template<typename OutputStream, typename = void>
+struct has_push : std::false_type {};
+
+template<typename OutputStream>
+struct has_push<OutputStream, std::void_t<decltype(std::declval<OutputStream&>().Push(size_t(1)))>> : std::true_type {};
+
+/**
+ * @brief 정수 출력이 빠른 Writer
+ *
+ * Document::Accept / PackedArray::write 등 Handler 템플릿으로 호출되므로
+ * 가린(hide) 멤버 함수가 그대로 선택됨 (가상 함수 불필요)
+ *
+ * @code
+ * rapidjson::StringBuffer buffer;
+ * json::detail::JsonWriter<rapidjson::StringBuffer> writer(buffer);
+ * document.Accept(writer);
+ * @endcode
+ */
+template<typename OutputStream>
+class JsonWriter : public rapidjson::Writer<OutputStream> {
+    using Base = rapidjson::Writer<OutputStream>;
+
+public:
+    explicit JsonWriter(OutputStream& os) : Base(os) {}
+
+    inline bool Int(int i) { return Int64(i); }
+    inline bool Uint(unsigned u) { return Uint64(u); }
+
+    inline bool Int64(int64_t i) {
+        this->Prefix(rapidjson::kNumberType);
+        const bool negative = i < 0;
+        const uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(i) : static_cast<uint64_t>(i);
+        return this->EndValue(writeInteger(magnitude, negative));
+    }
+
+    inline bool Uint64(uint64_t u) {
+        this->Prefix(rapidjson::kNumberType);
+        return this->EndValue(writeInteger(u, false));
+    }
+
+private:
+    inline bool writeInteger(uint64_t magnitude, bool negative) {
+        const unsigned digits = countDigits(magnitude);
+        if constexpr (has_push<OutputStream>::value) {
+            // 정확한 길이만큼만 확보 (Push 후 Pop 되돌림 없음)
+            char* p = this->os_->Push(digits + negative);
+            *p = '-';
+            writeDigits(magnitude, p + negative, digits);
+        } else {
+            char text[kMaxIntegerTextLength];
+            text[0] = '-';
+            writeDigits(magnitude, text + negative, digits);
+            for (unsigned i = 0; i < digits + negative; ++i) this->os_->Put(text[i]);
+        }
+        return true;
+    }
+};
+
+} // namespace detail
+} // namespace json
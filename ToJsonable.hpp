@@ -48,6 +48,105 @@ public:
         return documentToString();
     }
     
+    /**
+     * @brief 현재 document를 그대로 JSON 문자열로 직렬화 (saveToJson 호출 없음)
+     * 
+     * 프로토타입 복제본처럼 document가 이미 완성된 객체용
+     * setXXX/Begin/End로 document에 직접 쓴 값만 반영되고 멤버 필드 변경은 반영되지 않음
+     */
+    std::string toJsonDocument() const {
+        return documentToString();
+    }
+    
+    /**
+     * @brief 출력 크기를 maxBytes 이내로 제한한 직렬화 (로그용)
+     * 
+     * @param maxBytes 출력 바이트 상한 (루트 구조 최소 크기보다 작으면 최소 크기)
+     * @return 항상 유효한 JSON 문자열
+     * 
+     * 예산을 넘는 지점에서 쓰기를 멈추고:
+     * - 문자열 값은 들어가는 만큼 잘라 "..." 을 붙임 ("abc...")
+     * - 잘린 배열은 마지막 요소로 "...", 잘린 객체는 마지막 멤버로 "...":"..." 추가
+     * - 열린 배열/객체를 모두 닫음
+     * 
+     * 전체를 직렬화한 뒤 자르는 것과 달리 예산 이후 값은 순회하지 않음
+     * (JsonableBudget.hpp 필요)
+     */
+    template<typename Writer = detail::BudgetWriter>
+    std::string toJson(size_t maxBytes) const {
+        const_cast<ToJsonable*>(this)->saveToJson();
+        return documentToString<Writer>(maxBytes);
+    }
+    
+    /**
+     * @brief 청크 목록 버퍼로 직렬화 (매우 큰 출력용)
+     * 
+     * @param out 결과를 덧붙일 rope 버퍼
+     * @return 직렬화 성공 여부
+     * 
+     * 단일 연속 버퍼와 달리 커지면서 이미 쓴 바이트를 재할당/복사하지 않음
+     * 결과는 out.drain()으로 청크 단위 소비, 필요 시에만 out.toString()
+     * (JsonableRope.hpp 필요)
+     */
+    template<typename Rope, typename = std::enable_if_t<std::is_same_v<Rope, RopeBuffer>>>
+    bool toJson(Rope& out) const {
+        const_cast<ToJsonable*>(this)->saveToJson();
+        return documentToStream(out);
+    }
+    
+    /**
+     * @brief 객체를 출력 스트림(sink)으로 직접 직렬화
+     * 
+     * @param sink RapidJSON OutputStream 개념을 만족하는 객체 (Put(char), Flush())
+     * @return 직렬화 성공 여부 (공간 부족 등은 sink가 따로 보고)
+     * 
+     * 중간 문자열 없이 소켓 버퍼, 공유 메모리 슬롯 등에 바로 기록할 때 사용
+     */
+    template<typename Sink>
+    bool toJsonSink(Sink& sink) const {
+        const_cast<ToJsonable*>(this)->saveToJson();
+        return documentToStream(sink);
+    }
+    
+    /**
+     * @brief 객체를 iovec 세그먼트 목록으로 직렬화 (writev/sendmsg용)
+     * 
+     * @param out 결과를 덧붙일 버퍼 (여러 객체를 이어서 한 번에 전송 가능)
+     * @return 직렬화 성공 여부
+     * 
+     * 길이가 out.referenceThreshold() 이상인 문자열 값은 복사하지 않고 document를 가리킴
+     * → 전송이 끝나기 전에 객체를 수정/파괴하거나 다시 직렬화하지 말 것
+     * (JsonableIovec.hpp 필요, POSIX 전용)
+     */
+    template<typename Buffer, typename Writer = detail::IovecWriter,
+             typename = std::enable_if_t<std::is_same_v<Buffer, IovecBuffer>>>
+    bool toJsonIov(Buffer& out) const {
+        const_cast<ToJsonable*>(this)->saveToJson();
+        return documentToStream<Buffer, Writer>(out);
+    }
+    
+    /**
+     * @brief 객체에서 JSON 문자열로 병렬 직렬화
+     * 
+     * @param threadCount 사용할 스레드 수 (0 = 하드웨어 스레드 수)
+     * @return JSON 문자열 (toJson()과 동일한 결과)
+     * 
+     * 내부 동작:
+     * 1. saveToJson() 호출하여 사용자가 데이터 저장 (단일 스레드)
+     * 2. 완성된 document를 독립 서브트리로 분할하여 공용 work-stealing 풀에서 직렬화
+     *    (워커 스레드는 처음 필요할 때 생성되어 이후 호출에서 재사용됨)
+     * 3. 서브트리별 버퍼를 원래 순서대로 이어 붙임
+     * 
+     * 수천 개의 카테고리/항목을 가진 대형 트리처럼 큰 응답에 적합하며,
+     * 작은 document(노드 수 + 문자열 크기 추정치가 기준 미만)는 자동으로 단일 스레드 경로를 사용함
+     * (JsonableParallel.hpp 필요)
+     */
+    template<typename Serializer = detail::ParallelSerializer>
+    std::string toJsonParallel(size_t threadCount = 0) const {
+        const_cast<ToJsonable*>(this)->saveToJson();
+        return documentToStringParallel<Serializer>(threadCount);
+    }
+    
     /**
      * @brief 데이터를 내부 JSON 객체로 저장 (사용자 구현 필수)
      * 
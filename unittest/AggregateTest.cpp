@@ -0,0 +1,200 @@
+/**
+ * AggregateTest.cpp - 필드 스캐너 / NDJSON group-by 집계 테스트
+ *
+ * 테스트 영역:
+ * - 스캐너: 중첩 경로, 이스케이프 문자열, 건너뛰는 값 안의 괄호/따옴표, 깨진 입력
+ * - 집계: count/sum/min/max, 없는 필드, 타입이 다른 같은 원문 키
+ * - top-k, JSON 출력, 스트림 청크 경계
+ * - 결과가 fromJson 기반 집계와 동일한지
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+#include <map>
+#include <random>
+#include <sstream>
+
+using namespace json;
+
+class AggregateTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+std::string text(const detail::ScanValue& value) {
+    return std::string(value.text, value.length);
+}
+
+class Event : public Jsonable {
+public:
+    std::string region;
+    int64_t bytes = 0;
+
+    void loadFromJson() override {
+        region = getString("region");
+        bytes = getInt64("bytes");
+    }
+    void saveToJson() override {
+        setString("region", region);
+        setInt64("bytes", bytes);
+    }
+};
+
+} // namespace
+
+// 스캐너: 요청한 필드만 원문 범위로
+TEST_F(AggregateTest, ScannerFindsNestedAndEscapedFields) {
+    detail::FieldScanner scanner({"name", "http.status", "http", "skip.me", "missing"});
+    std::vector<detail::ScanValue> values(scanner.fieldCount());
+    const std::string line =
+        R"({"noise":{"a":["}",{"\"":"]"}]},"name":"a\"b\\","http":{"status":404,"tags":[1,2]},"skip":[1],"x":1})";
+
+    ASSERT_TRUE(scanner.scan(line.data(), line.size(), values.data()));
+    EXPECT_EQ(values[0].kind, detail::ScanKind::String);
+    EXPECT_TRUE(values[0].escaped);
+    std::string decoded;
+    ASSERT_TRUE(detail::unescapeString(values[0].text, values[0].length, decoded));
+    EXPECT_EQ(decoded, "a\"b\\");
+
+    EXPECT_EQ(values[1].kind, detail::ScanKind::Number);
+    EXPECT_EQ(text(values[1]), "404");
+    EXPECT_EQ(values[2].kind, detail::ScanKind::Object);
+    EXPECT_EQ(text(values[2]), R"({"status":404,"tags":[1,2]})");
+    EXPECT_EQ(values[3].kind, detail::ScanKind::Missing);   // skip은 객체가 아님
+    EXPECT_EQ(values[4].kind, detail::ScanKind::Missing);
+}
+
+TEST_F(AggregateTest, ScannerRejectsMalformedInput) {
+    detail::FieldScanner scanner({"b"});
+    std::vector<detail::ScanValue> values(scanner.fieldCount());
+    for (const char* bad : {"[1,2]", "\"str\"", "{\"a\":\"unterminated", "{\"a\":{\"x\":1", "{\"a\":}", "{\"a\" 1}"}) {
+        EXPECT_FALSE(scanner.scan(bad, std::strlen(bad), values.data())) << bad;
+    }
+    // 필요한 필드를 찾은 뒤의 깨진 부분은 읽지 않음
+    const char* tail = "{\"b\":1,\"c\":!!!";
+    EXPECT_TRUE(scanner.scan(tail, std::strlen(tail), values.data()));
+
+    std::string decoded;
+    EXPECT_TRUE(detail::unescapeString("\\u00e9\\ud83d\\ude00", 18, decoded));
+    EXPECT_EQ(decoded, "\xC3\xA9\xF0\x9F\x98\x80");
+    EXPECT_FALSE(detail::unescapeString("\\ud83d", 6, decoded));
+}
+
+// 기본 group-by
+TEST_F(AggregateTest, GroupByWithAllMetrics) {
+    Aggregator report({"region", "status"});
+    const size_t count = report.addCount();
+    const size_t sum = report.addSum("bytes");
+    const size_t low = report.addMin("ms");
+    const size_t high = report.addMax("ms");
+
+    const std::string input =
+        "{\"region\":\"eu\",\"status\":200,\"bytes\":100,\"ms\":5}\n"
+        "{\"region\":\"us\",\"status\":200,\"bytes\":50,\"ms\":1.5}\r\n"
+        "\n"
+        "  {\"status\":200,\"region\":\"eu\",\"bytes\":7,\"ms\":9}\n"
+        "{\"region\":\"eu\",\"status\":\"200\",\"bytes\":\"n/a\"}\n"
+        "not json\n"
+        "{\"region\":\"us\",\"status\":500,\"bytes\":1}";
+    report.consume(input.data(), input.size());
+
+    EXPECT_EQ(report.lineCount(), 5u);
+    EXPECT_EQ(report.skippedLines(), 1u);
+    const auto rows = report.rows();
+    ASSERT_EQ(rows.size(), 4u);
+
+    EXPECT_EQ(rows[0].keys, std::vector<std::string>({"eu", "200"}));
+    EXPECT_EQ(rows[0].values[count], 2);
+    EXPECT_EQ(rows[0].values[sum], 107);
+    EXPECT_EQ(rows[0].values[low], 5);
+    EXPECT_EQ(rows[0].values[high], 9);
+
+    // 문자열 "200"은 숫자 200과 다른 그룹, 숫자 아닌 값은 제외
+    EXPECT_EQ(rows[2].keyKinds[1], detail::ScanKind::String);
+    EXPECT_EQ(rows[2].values[sum], 0);
+    EXPECT_TRUE(std::isinf(rows[2].values[low]));
+
+    const auto top = report.top(sum, 2);
+    ASSERT_EQ(top.size(), 2u);
+    EXPECT_EQ(top[0].values[sum], 107);
+    EXPECT_EQ(top[1].keys[0], "us");
+    EXPECT_EQ(top[1].values[high], 1.5);
+    EXPECT_EQ(report.top(sum, 10, false).front().values[sum], 0);
+
+    EXPECT_EQ(report.addCount(), Aggregator::kNoMetric);
+}
+
+// count는 필드를 읽지 않으므로 나머지 필드를 찾으면 줄 끝까지 스캔하지 않음
+TEST_F(AggregateTest, CountMetricKeepsEarlyStop) {
+    Aggregator report({"region"});
+    const size_t count = report.addCount();
+    const size_t sum = report.addSum("bytes");
+    const size_t countAgain = report.addCount();
+
+    const std::string input =
+        "{\"region\":\"eu\",\"bytes\":4,\"rest\":[1,2,3  \n"
+        "{\"bytes\":6,\"region\":\"eu\",\"rest\":!!!\n";
+    report.consume(input.data(), input.size());
+
+    EXPECT_EQ(report.lineCount(), 2u);
+    EXPECT_EQ(report.skippedLines(), 0u);
+    const auto rows = report.rows();
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows[0].values[count], 2);
+    EXPECT_EQ(rows[0].values[sum], 10);
+    EXPECT_EQ(rows[0].values[countAgain], 2);
+}
+
+TEST_F(AggregateTest, ToJsonOutput) {
+    Aggregator report({"k"});
+    report.addCount();
+    report.addSum("v");
+    report.addMax("w");
+    const std::string input = "{\"k\":\"a\\nb\",\"v\":1.5}\n{\"v\":2}\n{\"k\":true,\"v\":3,\"w\":-1}\n";
+    report.consume(input.data(), input.size());
+
+    EXPECT_EQ(report.toJson(),
+              "[{\"k\":\"a\\nb\",\"count\":1,\"sum(v)\":1.5,\"max(w)\":null},"
+              "{\"k\":null,\"count\":1,\"sum(v)\":2,\"max(w)\":null},"
+              "{\"k\":true,\"count\":1,\"sum(v)\":3,\"max(w)\":-1}]");
+}
+
+// 스트림 입력: 청크 경계에 걸친 줄, 청크보다 긴 줄, fromJson 기반 결과와 비교
+TEST_F(AggregateTest, StreamMatchesFromJsonReference) {
+    std::mt19937 rng(11);
+    std::ostringstream ndjson;
+    std::map<std::string, std::pair<int64_t, int64_t>> expected;   // region -> (count, sum)
+    for (int i = 0; i < 5000; ++i) {
+        Event event;
+        event.region = "r" + std::to_string(rng() % 13);
+        event.bytes = static_cast<int64_t>(rng() % 100000) - 5000;
+        if (i == 1234) event.region.append(200000, 'x');   // 64KB 청크보다 긴 줄
+        ndjson << event.toJson() << '\n';
+
+        Event reference;
+        reference.fromJson(event.toJson());
+        auto& entry = expected[reference.region];
+        ++entry.first;
+        entry.second += reference.bytes;
+    }
+
+    Aggregator report({"region"});
+    const size_t count = report.addCount();
+    const size_t sum = report.addSum("bytes");
+    std::istringstream in(ndjson.str());
+    ASSERT_TRUE(report.consume(in));
+
+    EXPECT_EQ(report.lineCount(), 5000u);
+    const auto rows = report.rows();
+    ASSERT_EQ(rows.size(), expected.size());
+    for (const auto& row : rows) {
+        const auto it = expected.find(row.keys[0]);
+        ASSERT_NE(it, expected.end());
+        EXPECT_EQ(row.values[count], it->second.first);
+        EXPECT_EQ(row.values[sum], it->second.second);
+    }
+}
@@ -236,3 +236,152 @@ TEST_F(ArrayTest, NestedArrayObjectPattern) {
     EXPECT_TRUE(json.find("[[1,2,3],[4,5,6],[7,8,9]]") != std::string::npos ||
                 json.find("[ [ 1, 2, 3 ], [ 4, 5, 6 ], [ 7, 8, 9 ] ]") != std::string::npos);
 }
+
+// 고정 길이 배열 (std::array / 호출자 버퍼) 테스트
+TEST_F(ArrayTest, FixedSizeArrays) {
+    class Pixel : public Jsonable {
+    public:
+        std::array<double, 3> position{};
+        std::array<uint32_t, 3> rgb{};
+        std::array<std::string, 2> labels;
+        float weights[4] = {};
+        std::array<int64_t, 32> histogram{};
+        
+        bool loaded = false;
+        
+        void loadFromJson() override {
+            loaded = getArray("position", position) &&
+                     getArray("rgb", rgb) &&
+                     getArray("labels", labels) &&
+                     getArray("weights", weights, 4) &&
+                     getArray("histogram", histogram);
+        }
+        
+        void saveToJson() override {
+            setArray("position", position);
+            setArray("rgb", rgb);
+            setArray("labels", labels);
+            setArray("weights", weights, 4);
+            setArray("histogram", histogram);
+        }
+    };
+    
+    Pixel original;
+    original.position = {1.5, -2.0, 3.25};
+    original.rgb = {255, 128, 0};
+    original.labels = {"edge", "corner"};
+    original.weights[0] = 0.5f;
+    original.weights[3] = 2.0f;
+    for (size_t i = 0; i < original.histogram.size(); ++i) {
+        original.histogram[i] = static_cast<int64_t>(i * i);
+    }
+    
+    std::string json = original.toJson();
+    EXPECT_NE(json.find("\"position\":[1.5,-2.0,3.25]"), std::string::npos);
+    EXPECT_NE(json.find("\"rgb\":[255,128,0]"), std::string::npos);
+    
+    Pixel loaded;
+    loaded.fromJson(json);
+    EXPECT_TRUE(loaded.loaded);
+    EXPECT_EQ(loaded.position, original.position);
+    EXPECT_EQ(loaded.rgb, original.rgb);
+    EXPECT_EQ(loaded.labels, original.labels);
+    EXPECT_EQ(loaded.weights[3], 2.0f);
+    EXPECT_EQ(loaded.histogram, original.histogram);
+    
+    // 길이 불일치 / 누락: false, 대상 변경 없음
+    Pixel mismatch;
+    mismatch.fromJson(R"({"position":[1,2],"rgb":[1,2,3,4]})");
+    std::array<double, 3> position = {9.0, 9.0, 9.0};
+    EXPECT_FALSE(mismatch.getArray("position", position));
+    EXPECT_EQ(position[0], 9.0);
+    
+    std::array<uint32_t, 3> rgb = {7, 7, 7};
+    EXPECT_FALSE(mismatch.getArray("rgb", rgb));
+    EXPECT_EQ(rgb[2], 7u);
+    
+    double buffer[2] = {0.0, 0.0};
+    EXPECT_FALSE(mismatch.getArray("missing", buffer, 2));
+    EXPECT_TRUE(mismatch.getArray("position", buffer, 2));
+    EXPECT_EQ(buffer[1], 2.0);
+    
+    // packed 배열도 길이 검사 후 제자리 변환
+    std::array<int64_t, 31> shorter{};
+    EXPECT_FALSE(loaded.getArray("histogram", shorter));
+    std::array<double, 32> converted{};
+    EXPECT_TRUE(loaded.getArray("histogram", converted));
+    EXPECT_EQ(converted[31], 961.0);
+}
+
+// 다차원 숫자 배열 (Matrix) 테스트
+TEST_F(ArrayTest, MatrixHandling) {
+    class Features : public Jsonable {
+    public:
+        Matrix<double> weights;
+        Matrix<int> cube;
+        Matrix<float> series;
+        
+        void loadFromJson() override {
+            weights = getMatrix<double>("weights");
+            cube = getMatrix<int>("cube");
+            series = getMatrix<float>("series");
+        }
+        
+        void saveToJson() override {
+            setMatrix("weights", weights);
+            setMatrix("cube", cube);
+            setMatrix("series", series);
+            beginObject("meta");
+            {
+                setMatrix("identity", Matrix<int64_t>({2, 2}, {1, 0, 0, 1}));
+            }
+            endObject();
+        }
+    };
+    
+    Features original;
+    original.weights = Matrix<double>({2, 3}, {0.5, 1.0, 1.5, 2.0, 2.5, 3.0});
+    original.cube.shape = {2, 3, 4};
+    original.cube.data.resize(24);
+    for (size_t i = 0; i < 24; ++i) original.cube.data[i] = static_cast<int>(i);
+    original.series = Matrix<float>({40}, std::vector<float>(40, 0.25f));
+    
+    std::string json = original.toJson();
+    EXPECT_NE(json.find("\"weights\":[[0.5,1.0,1.5],[2.0,2.5,3.0]]"), std::string::npos);
+    EXPECT_NE(json.find("\"cube\":[[[0,1,2,3],[4,5,6,7],[8,9,10,11]],[[12,13,14,15]"), std::string::npos);
+    EXPECT_NE(json.find("\"meta\":{\"identity\":[[1,0],[0,1]]}"), std::string::npos);
+    
+    Features loaded;
+    loaded.fromJson(json);
+    EXPECT_EQ(loaded.weights.shape, (std::vector<size_t>{2, 3}));
+    EXPECT_EQ(loaded.weights.data, original.weights.data);
+    EXPECT_EQ(loaded.cube.shape, (std::vector<size_t>{2, 3, 4}));
+    EXPECT_EQ(loaded.cube(1, 2, 3), 23);
+    EXPECT_EQ(loaded.cube(0, 1, 0), 4);
+    EXPECT_EQ(loaded.series.shape, (std::vector<size_t>{40}));
+    EXPECT_EQ(loaded.series.data, original.series.data);
+    
+    // 직사각형이 아니거나 숫자가 아닌 요소: 빈 Matrix
+    Features invalid;
+    invalid.fromJson(R"({"ragged":[[1,2],[3]],"text":[["a","b"]],"deep":[[1,[2]]],"scalar":7,"empty":[[],[]]})");
+    EXPECT_TRUE(invalid.getMatrix<int>("ragged").empty());
+    EXPECT_TRUE(invalid.getMatrix<int>("ragged").shape.empty());
+    EXPECT_TRUE(invalid.getMatrix<double>("text").empty());
+    EXPECT_TRUE(invalid.getMatrix<double>("deep").empty());
+    EXPECT_TRUE(invalid.getMatrix<double>("missing").empty());
+    
+    auto scalar = invalid.getMatrix<int>("scalar");
+    EXPECT_EQ(scalar.rank(), 0u);
+    ASSERT_EQ(scalar.data.size(), 1u);
+    EXPECT_EQ(scalar.data[0], 7);
+    
+    auto empty = invalid.getMatrix<int>("empty");
+    EXPECT_EQ(empty.shape, (std::vector<size_t>{2, 0}));
+    EXPECT_TRUE(empty.isValid());
+    
+    // shape와 data 크기 불일치 (기본 생성된 빈 Matrix 포함): null
+    Features mismatch;
+    mismatch.weights = Matrix<double>({2, 2}, {1.0, 2.0, 3.0});
+    EXPECT_EQ(mismatch.toJson(),
+              "{\"weights\":null,\"cube\":null,\"series\":null,\"meta\":{\"identity\":[[1,0],[0,1]]}}");
+}
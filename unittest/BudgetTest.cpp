@@ -0,0 +1,131 @@
+/**
+ * BudgetTest.cpp - 바이트 예산 제한 직렬화 테스트
+ *
+ * 테스트 영역:
+ * - 모든 예산에서 결과가 maxBytes 이내이고 유효한 JSON인지
+ * - 충분한 예산이면 toJson()과 동일 (실수 표기 포함)
+ * - 문자열/배열/객체 잘림 표시, UTF-8 문자 경계 보존
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class BudgetTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class LogEntry : public Jsonable {
+public:
+    std::string message;
+    std::vector<int64_t> samples;
+    std::vector<double> packed;
+
+    void loadFromJson() override {}
+    void saveToJson() override {
+        setString("level", "warn");
+        setInt64("code", -1234567);
+        setString("message", message);
+        setArray("packed", packed);
+        beginObject("context");
+        setString("host", "node-\"7\"\n");
+        setBool("retry", true);
+        beginArray("samples");
+        for (int64_t v : samples) pushInt64(v);
+        endArray();
+        endObject();
+        setDouble("ratio", 0.25);
+    }
+};
+
+LogEntry makeEntry() {
+    LogEntry entry;
+    entry.message = "디스크 사용량 경고: ";
+    for (int i = 0; i < 20; ++i) entry.message += "블록" + std::to_string(i) + " ";
+    for (int64_t i = 0; i < 50; ++i) entry.samples.push_back(i * 1001);
+    for (int i = 0; i < 32; ++i) entry.packed.push_back(i * 0.5);
+    return entry;
+}
+
+// 실수 표기 비교용 (정수형 실수, 지수 표기, 최대 자릿수)
+class Doubles : public Jsonable {
+public:
+    void loadFromJson() override {}
+    void saveToJson() override {
+        beginArray("values");
+        for (double v : {0.0, -0.0, 1.0, -2.5, 0.1, 1.0 / 3.0, 123456789.0, 1e21, 1e-7, -1.7976931348623157e308,
+                         4.9406564584124654e-324, 2.2250738585072014e-308}) {
+            pushDouble(v);
+        }
+        endArray();
+    }
+};
+
+bool isValidJson(const std::string& text) {
+    rapidjson::Document document;
+    document.Parse(text.c_str(), text.size());
+    return !document.HasParseError();
+}
+
+} // namespace
+
+// 충분한 예산: 전체 출력과 동일
+TEST_F(BudgetTest, LargeBudgetMatchesToJson) {
+    const std::string full = makeEntry().toJson();
+    EXPECT_EQ(makeEntry().toJson(full.size()), full);
+    EXPECT_EQ(makeEntry().toJson(full.size() * 2), full);
+    EXPECT_NE(makeEntry().toJson(full.size() - 1), full);
+
+    const std::string doubles = Doubles().toJson();
+    EXPECT_EQ(Doubles().toJson(doubles.size()), doubles);
+}
+
+// 모든 예산에서 상한과 유효성 유지
+TEST_F(BudgetTest, EveryBudgetIsBoundedAndValid) {
+    const size_t fullSize = makeEntry().toJson().size();
+    for (size_t budget = 13; budget < fullSize; ++budget) {
+        const std::string out = makeEntry().toJson(budget);
+        EXPECT_LE(out.size(), budget) << out;
+        EXPECT_TRUE(isValidJson(out)) << out;
+        EXPECT_NE(out.find("\"...\""), std::string::npos) << out;
+    }
+
+    // 루트 구조보다 작은 예산: 최소 출력
+    EXPECT_EQ(makeEntry().toJson(0), "{\"...\":\"...\"}");
+}
+
+// 잘림 표시 형태
+TEST_F(BudgetTest, TruncationMarkers) {
+    // 긴 문자열 값: 들어가는 만큼 + "...", 이후 멤버는 객체 표시로 대체
+    std::string out = makeEntry().toJson(80);
+    EXPECT_EQ(out.rfind("{\"level\":\"warn\",\"code\":-1234567,\"message\":\"디스크", 0), 0u) << out;
+    EXPECT_NE(out.find("...\",\"...\":\"...\"}"), std::string::npos) << out;
+    EXPECT_TRUE(isValidJson(out));
+
+    // UTF-8 문자 중간에서 자르지 않음: 모든 예산에서 문자열 앞부분이 원문 접두사
+    const std::string message = makeEntry().message;
+    for (size_t budget = 60; budget < 140; ++budget) {
+        const std::string text = makeEntry().toJson(budget);
+        const size_t begin = text.find("\"message\":\"");
+        if (begin == std::string::npos) continue;
+        const size_t start = begin + 11;
+        const size_t end = text.find("...\"", start);
+        ASSERT_NE(end, std::string::npos) << text;
+        EXPECT_EQ(message.compare(0, end - start, text, start, end - start), 0) << text;
+    }
+
+    // 중첩 배열 안에서 잘림: 배열/객체 모두 표시 후 닫힘
+    LogEntry entry = makeEntry();
+    entry.message = "short";
+    const std::string full = LogEntry(entry).toJson();
+    const size_t samples = full.find("\"samples\":[");
+    ASSERT_NE(samples, std::string::npos);
+    out = entry.toJson(samples + 60);
+    EXPECT_NE(out.find(",\"...\"],\"...\":\"...\"},\"...\":\"...\"}"), std::string::npos) << out;
+    EXPECT_TRUE(isValidJson(out));
+}
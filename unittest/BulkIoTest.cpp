@@ -0,0 +1,161 @@
+/**
+ * BulkIoTest.cpp - 대량 파일 로드/저장 엔진 테스트
+ *
+ * 테스트 영역:
+ * - io_uring / 블로킹 백엔드 각각 저장 → 로드 왕복
+ * - 동시 I/O 수보다 많은 파일 (슬롯 재사용, 버퍼 큐 제한)
+ * - 없는 파일, 빈 파일, 쓸 수 없는 경로의 실패 인덱스
+ * - loadFromJson/saveToJson 예외 전파 (이후 재사용 가능)
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableBulkIo.hpp"
+
+#if defined(JSONABLE_HAS_BULK_IO)
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+using namespace json;
+
+class BulkIoTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/jsonable_bulk_XXXXXX";
+        directory = mkdtemp(pattern);
+    }
+    void TearDown() override {
+        for (const auto& path : created) std::remove(path.c_str());
+        rmdir(directory.c_str());
+    }
+
+    std::vector<std::string> makePaths(size_t count) {
+        std::vector<std::string> paths;
+        for (size_t i = 0; i < count; ++i) {
+            paths.push_back(directory + "/record_" + std::to_string(i) + ".json");
+            created.push_back(paths.back());
+        }
+        return paths;
+    }
+
+    std::string directory;
+    std::vector<std::string> created;
+};
+
+namespace {
+
+class Record : public Jsonable {
+public:
+    int64_t id = 0;
+    std::string payload;
+
+    void loadFromJson() override {
+        id = getInt64("id");
+        payload = getString("payload");
+    }
+    void saveToJson() override {
+        setInt64("id", id);
+        setString("payload", payload);
+    }
+};
+
+// id 7에서 예외를 던지는 레코드
+class ThrowingRecord : public Record {
+public:
+    void loadFromJson() override {
+        Record::loadFromJson();
+        if (id == 7) throw std::runtime_error("load");
+    }
+    void saveToJson() override {
+        if (id == 7) throw std::runtime_error("save");
+        Record::saveToJson();
+    }
+};
+
+std::vector<Record> makeRecords(size_t count) {
+    std::vector<Record> records(count);
+    for (size_t i = 0; i < count; ++i) {
+        records[i].id = static_cast<int64_t>(i);
+        // 일부는 한 번의 읽기로 끝나지 않을 만큼 크게
+        records[i].payload = std::string(i % 50 == 0 ? 300000 : 16 + i % 7, static_cast<char>('a' + i % 26));
+    }
+    return records;
+}
+
+void roundTrip(BulkIo& io, const std::vector<std::string>& paths) {
+    auto records = makeRecords(paths.size());
+    BulkResult saved = io.saveAll(paths, records);
+    EXPECT_TRUE(saved.ok());
+    EXPECT_EQ(saved.succeeded, paths.size());
+
+    std::vector<Record> loaded;
+    BulkResult result = io.loadAll(paths, loaded);
+    EXPECT_TRUE(result.ok());
+    ASSERT_EQ(loaded.size(), paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        EXPECT_EQ(loaded[i].id, static_cast<int64_t>(i));
+        EXPECT_EQ(loaded[i].payload, records[i].payload);
+    }
+}
+
+} // namespace
+
+TEST_F(BulkIoTest, RoundTripWithIoUring) {
+    BulkIo io(4, 8);
+    if (!io.usesIoUring()) GTEST_SKIP() << "io_uring unavailable";
+    roundTrip(io, makePaths(300));
+}
+
+TEST_F(BulkIoTest, RoundTripWithBlockingFallback) {
+    BulkIo io(4, 8, BulkBackend::Blocking);
+    EXPECT_FALSE(io.usesIoUring());
+    roundTrip(io, makePaths(120));
+}
+
+TEST_F(BulkIoTest, ReportsFailedIndexes) {
+    auto paths = makePaths(4);
+    auto records = makeRecords(4);
+    for (BulkBackend backend : {BulkBackend::Auto, BulkBackend::Blocking}) {
+        BulkIo io(2, 4, backend);
+        ASSERT_TRUE(io.saveAll(paths, records).ok());
+
+        std::vector<std::string> inputs = paths;
+        inputs[1] = directory + "/missing.json";
+        std::ofstream(paths[3], std::ios::trunc).close();   // 빈 파일
+
+        std::vector<Record> loaded;
+        BulkResult result = io.loadAll(inputs, loaded);
+        EXPECT_EQ(result.succeeded, 2u);
+        EXPECT_EQ(result.failed, (std::vector<size_t>{1, 3}));
+        EXPECT_EQ(loaded[2].id, 2);
+
+        std::vector<std::string> outputs = paths;
+        outputs[0] = directory + "/no_such_dir/out.json";
+        BulkResult saved = io.saveAll(outputs, records);
+        EXPECT_EQ(saved.failed, (std::vector<size_t>{0}));
+        EXPECT_EQ(saved.succeeded, 3u);
+    }
+}
+
+TEST_F(BulkIoTest, PropagatesCallbackExceptions) {
+    auto paths = makePaths(40);
+    auto records = makeRecords(paths.size());
+    for (BulkBackend backend : {BulkBackend::Auto, BulkBackend::Blocking}) {
+        BulkIo io(2, 4, backend);
+        ASSERT_TRUE(io.saveAll(paths, records).ok());
+
+        std::vector<ThrowingRecord> loaded;
+        EXPECT_THROW(io.loadAll(paths, loaded), std::runtime_error);
+
+        std::vector<ThrowingRecord> throwing(paths.size());
+        for (size_t i = 0; i < throwing.size(); ++i) throwing[i].id = static_cast<int64_t>(i);
+        EXPECT_THROW(io.saveAll(paths, throwing), std::runtime_error);
+
+        // 예외 이후에도 같은 엔진으로 계속 사용 가능
+        roundTrip(io, paths);
+    }
+}
+
+#endif // JSONABLE_HAS_BULK_IO
@@ -0,0 +1,163 @@
+/**
+ * CollectionTest.cpp - 색인 컬렉션 테스트
+ *
+ * 테스트 영역:
+ * - 해시/정렬 색인 동등 조회, 범위 조회, 정렬 순회
+ * - 삭제/갱신 후 색인 일관성, 핸들 재사용
+ * - 색인 결과가 전체 스캔 결과와 동일한지
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+#include <algorithm>
+#include <random>
+
+using namespace json;
+
+class CollectionTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class User : public Jsonable {
+public:
+    std::string email;
+    std::string city;
+    int64_t age = 0;
+
+    User() = default;
+    User(std::string e, std::string c, int64_t a) : email(std::move(e)), city(std::move(c)), age(a) {}
+
+    void loadFromJson() override {
+        email = getString("email");
+        city = getString("city");
+        age = getInt64("age");
+    }
+    void saveToJson() override {
+        setString("email", email);
+        setString("city", city);
+        setInt64("age", age);
+    }
+};
+
+void addIndexes(Collection<User>& users) {
+    users.addHashIndex<std::string>("email", [](const User& u) { return u.email; });
+    users.addHashIndex<std::string>("city", [](const User& u) { return u.city; });
+    users.addOrderedIndex<int64_t>("age", [](const User& u) { return u.age; });
+}
+
+std::vector<int64_t> ages(const std::vector<const User*>& users) {
+    std::vector<int64_t> result;
+    for (const User* u : users) result.push_back(u->age);
+    return result;
+}
+
+} // namespace
+
+// 동등/범위 조회 기본 동작
+TEST_F(CollectionTest, EqualityAndRangeQueries) {
+    Collection<User> users;
+    addIndexes(users);
+    users.insert(User("a@x", "seoul", 31));
+    users.insert(User("b@x", "busan", 25));
+    users.insert(User("c@x", "seoul", 40));
+    users.insertJson(R"({"email":"d@x","city":"seoul","age":25})");
+
+    ASSERT_NE(users.findFirst<std::string>("email", "d@x"), nullptr);
+    EXPECT_EQ(users.findFirst<std::string>("email", "d@x")->age, 25);
+    EXPECT_EQ(users.findFirst<std::string>("email", "none"), nullptr);
+    EXPECT_EQ(users.count<std::string>("city", "seoul"), 3u);
+    EXPECT_EQ(users.count<int64_t>("age", 25), 2u);
+
+    EXPECT_EQ(ages(users.findRange<int64_t>("age", 25, 31)), std::vector<int64_t>({25, 25, 31}));
+    EXPECT_TRUE(users.findRange<int64_t>("age", 50, 60).empty());
+
+    std::vector<int64_t> descending;
+    users.forEachOrdered<int64_t>("age", [&](const User& u) { descending.push_back(u.age); }, true);
+    EXPECT_EQ(descending, std::vector<int64_t>({40, 31, 25, 25}));
+
+    // 이름/키 타입 불일치, 해시 색인 범위 조회는 빈 결과
+    EXPECT_TRUE(users.findEqual<int64_t>("email", 1).empty());
+    EXPECT_TRUE(users.findRange<std::string>("city", "a", "z").empty());
+    EXPECT_TRUE(users.findEqual<std::string>("missing", "x").empty());
+}
+
+// 삭제/갱신 시 색인 갱신, 핸들 재사용
+TEST_F(CollectionTest, EraseAndUpdateKeepIndexesConsistent) {
+    Collection<User> users;
+    addIndexes(users);
+    const auto first = users.insert(User("a@x", "seoul", 31));
+    const auto second = users.insert(User("b@x", "busan", 25));
+
+    EXPECT_TRUE(users.update(second, [](User& u) { u.city = "seoul"; u.age = 50; }));
+    EXPECT_EQ(users.count<std::string>("city", "busan"), 0u);
+    EXPECT_EQ(users.count<std::string>("city", "seoul"), 2u);
+    EXPECT_EQ(ages(users.findRange<int64_t>("age", 0, 100)), std::vector<int64_t>({31, 50}));
+
+    EXPECT_TRUE(users.erase(first));
+    EXPECT_FALSE(users.erase(first));
+    EXPECT_EQ(users.get(first), nullptr);
+    EXPECT_EQ(users.findFirst<std::string>("email", "a@x"), nullptr);
+    EXPECT_EQ(users.size(), 1u);
+
+    const auto reused = users.insert(User("c@x", "daegu", 18));
+    EXPECT_EQ(reused, first);
+    EXPECT_EQ(users.findFirst<std::string>("city", "daegu")->email, "c@x");
+}
+
+// 나중에 추가한 색인도 기존 객체를 포함, 조기 중단
+TEST_F(CollectionTest, LateIndexAndEarlyStop) {
+    Collection<User> users;
+    for (int i = 0; i < 10; ++i) users.insert(User("u" + std::to_string(i), "x", 100 - i));
+    EXPECT_TRUE(users.addOrderedIndex<int64_t>("age", [](const User& u) { return u.age; }));
+    EXPECT_FALSE(users.addOrderedIndex<int64_t>("age", [](const User& u) { return u.age; }));
+
+    std::vector<int64_t> firstThree;
+    users.forEachOrdered<int64_t>("age", [&](const User& u) {
+        firstThree.push_back(u.age);
+        return firstThree.size() < 3;
+    });
+    EXPECT_EQ(firstThree, std::vector<int64_t>({91, 92, 93}));
+}
+
+// 무작위 작업 후 색인 결과 == 전체 스캔 결과
+TEST_F(CollectionTest, MatchesLinearScan) {
+    Collection<User> users;
+    addIndexes(users);
+    std::mt19937 rng(7);
+    std::vector<Collection<User>::Handle> handles;
+
+    for (int step = 0; step < 3000; ++step) {
+        const int op = static_cast<int>(rng() % 10);
+        if (op < 6 || handles.empty()) {
+            handles.push_back(users.insert(User("e" + std::to_string(step), "c" + std::to_string(rng() % 7),
+                                                static_cast<int64_t>(rng() % 80))));
+        } else if (op < 8) {
+            const size_t pick = rng() % handles.size();
+            users.erase(handles[pick]);
+            handles.erase(handles.begin() + pick);
+        } else {
+            const int64_t age = static_cast<int64_t>(rng() % 80);
+            users.update(handles[rng() % handles.size()], [&](User& u) { u.age = age; });
+        }
+    }
+
+    for (int64_t lower = 0; lower < 80; lower += 13) {
+        std::vector<int64_t> expected;
+        users.forEach([&](const User& u) {
+            if (u.age >= lower && u.age <= lower + 9) expected.push_back(u.age);
+        });
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(ages(users.findRange<int64_t>("age", lower, lower + 9)), expected);
+    }
+    for (int c = 0; c < 7; ++c) {
+        const std::string city = "c" + std::to_string(c);
+        size_t expected = 0;
+        users.forEach([&](const User& u) { expected += u.city == city; });
+        EXPECT_EQ(users.count<std::string>("city", city), expected);
+    }
+}
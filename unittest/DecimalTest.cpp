@@ -0,0 +1,188 @@
+/**
+ * DecimalTest.cpp - 고정 소수점 10진수 필드 테스트
+ *
+ * 테스트 영역:
+ * - getDecimal: 원문 10진수 직접 변환 / scale 변경 반올림 / 정수·지수 표기
+ * - setDecimal: scale 자리 그대로 출력, double 정밀도를 넘는 값
+ * - 덮어쓰기 / 복사 / 병렬 직렬화
+ * - 기본 모드: 파싱은 원문 표기를 보존하지 않음 (getDecimal만 원문에서 변환)
+ * - 루트 컨텍스트 덮어쓰기 / 중첩 컨텍스트 setDecimal
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableParallel.hpp"
+
+using namespace json;
+
+class DecimalTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class Ledger : public Jsonable {
+public:
+    void loadFromJson() override {}
+    void saveToJson() override {}
+};
+
+// 파싱한 10진수 원문을 보존하는 타입
+class PreciseLedger : public Ledger {
+public:
+    PreciseLedger() { preserveParsedDecimals(); }
+};
+
+} // namespace
+
+// 파싱된 숫자를 scaled 정수로 읽기
+TEST_F(DecimalTest, ReadsParsedNumbersExactly) {
+    PreciseLedger ledger;
+    ledger.fromJson(R"({"price":19.99,"tax":0.005,"qty":3,"big":123456789012345.67,)"
+                    R"("exp":1.5e2,"neg":-0.10,"text":"1.00","huge":18446744073709551615})");
+
+    EXPECT_EQ(ledger.getDecimal("price", 2), 1999);
+    EXPECT_EQ(ledger.getDecimal("price", 4), 199900);
+    EXPECT_EQ(ledger.getDecimal("price", 1), 200);       // 19.99 → 20.0
+    EXPECT_EQ(ledger.getDecimal("price", 0), 20);
+    EXPECT_EQ(ledger.getDecimal("tax", 2), 1);           // 0.005 → 0.01
+    EXPECT_EQ(ledger.getDecimal("tax", 3), 5);
+    EXPECT_EQ(ledger.getDecimal("qty", 2), 300);
+    EXPECT_EQ(ledger.getDecimal("big", 2), 12345678901234567LL);   // double로는 표현 불가
+    EXPECT_EQ(ledger.getDecimal("exp", 2), 15000);
+    EXPECT_EQ(ledger.getDecimal("neg", 2), -10);
+    EXPECT_EQ(ledger.getDecimal("neg", 3), -100);
+    EXPECT_EQ(ledger.getDecimal("neg", 0), 0);
+
+    EXPECT_EQ(ledger.getDecimal("missing", 2, -1), -1);
+    EXPECT_EQ(ledger.getDecimal("text", 2, -1), -1);
+    EXPECT_EQ(ledger.getDecimal("huge", 0, -1), -1);
+    EXPECT_EQ(ledger.getDecimal("big", 5, -1), -1);      // int64 범위 초과
+    EXPECT_EQ(ledger.getDecimal("price", 19, -1), -1);   // scale 범위 밖
+
+    // 원문 표기 유지 (-0.10, 17자리)
+    std::string json = ledger.toJson();
+    EXPECT_NE(json.find("\"big\":123456789012345.67"), std::string::npos);
+    EXPECT_NE(json.find("\"neg\":-0.10"), std::string::npos);
+    EXPECT_EQ(ledger.toJsonParallel(4), json);
+}
+
+// scale 자리 그대로 쓰기
+TEST_F(DecimalTest, WritesFixedScaleText) {
+    Ledger ledger;
+    ledger.setDecimal("amount", 12340, 2);
+    ledger.setDecimal("tiny", -5, 3);
+    ledger.setDecimal("whole", 42, 0);
+    ledger.setDecimal("precise", 9007199254740993LL, 4);
+    ledger.setDecimal("min", INT64_MIN, 18);
+    ledger.setDecimal("invalid", 1, -1);
+
+    EXPECT_EQ(ledger.toJson(),
+              "{\"amount\":123.40,\"tiny\":-0.005,\"whole\":42,\"precise\":900719925474.0993,"
+              "\"min\":-9.223372036854775808,\"invalid\":null}");
+
+    EXPECT_DOUBLE_EQ(ledger.getDouble("amount"), 123.4);
+    EXPECT_EQ(ledger.getDecimal("precise", 4), 9007199254740993LL);
+    EXPECT_EQ(ledger.getDecimal("min", 18), INT64_MIN);
+
+    // 다시 파싱해도 같은 값/표기
+    PreciseLedger reparsed;
+    reparsed.fromJson(ledger.toJson());
+    EXPECT_EQ(reparsed.getDecimal("precise", 4), 9007199254740993LL);
+    EXPECT_EQ(reparsed.toJson(), ledger.toJson());
+}
+
+// 덮어쓰기 / 복사
+TEST_F(DecimalTest, OverwriteAndCopy) {
+    Ledger ledger;
+    ledger.setDecimal("amount", 100, 2);
+
+    Ledger copied(ledger);
+    EXPECT_EQ(copied.toJson(), "{\"amount\":1.00}");
+
+    ledger.setDouble("amount", 2.5);
+    EXPECT_EQ(ledger.toJson(), "{\"amount\":2.5}");
+    EXPECT_EQ(ledger.getDecimal("amount", 2), 250);
+
+    ledger.setDecimal("amount", 7, 1);
+    EXPECT_EQ(ledger.toJson(), "{\"amount\":0.7}");
+
+    Ledger assigned;
+    assigned = copied;
+    EXPECT_EQ(assigned.getDecimal("amount", 2), 100);
+}
+
+// 기본 모드: 출력은 일반 document 경로, getDecimal은 원문에서 변환 (setDecimal 항목은 파싱 시 제거)
+TEST_F(DecimalTest, DefaultParseKeepsPlainOutput) {
+    Ledger ledger;
+    ledger.setDecimal("amount", 100, 2);
+    ledger.fromJson(R"({"price":1.50,"qty":3,"neg":-0.10,"big":123456789012345.67})");
+
+    std::string json = ledger.toJson();
+    EXPECT_NE(json.find("{\"price\":1.5,\"qty\":3,\"neg\":-0.1,"), std::string::npos);
+    EXPECT_EQ(ledger.toJsonParallel(4), json);
+    EXPECT_EQ(ledger.getDecimal("price", 2), 150);
+    EXPECT_EQ(ledger.getDecimal("neg", 2), -10);
+    EXPECT_EQ(ledger.getDecimal("big", 2), 12345678901234567LL);   // double로는 표현 불가
+    EXPECT_EQ(ledger.getDecimal("amount", 2, -1), -1);
+
+    // 덮어쓰면 원문 값도 버림
+    ledger.setDouble("big", 0.25);
+    EXPECT_EQ(ledger.getDecimal("big", 2), 25);
+
+    // 복사본/대입 대상도 같은 모드 유지
+    PreciseLedger precise;
+    PreciseLedger copied(precise);
+    copied.fromJson(R"({"price":1.50})");
+    EXPECT_EQ(copied.toJson(), "{\"price\":1.50}");
+
+    Ledger assigned;
+    assigned = precise;
+    assigned.fromJson(R"({"price":1.50})");
+    EXPECT_EQ(assigned.toJson(), "{\"price\":1.50}");
+
+    Ledger moved;
+    moved = std::move(copied);
+    moved.fromJson(R"({"price":2.50})");
+    EXPECT_EQ(moved.toJson(), "{\"price\":2.50}");
+}
+
+// 키 없는 beginObject()는 루트 document 컨텍스트: 덮어쓰면 원문 값/packed 버퍼도 교체
+TEST_F(DecimalTest, RootContextOverwriteDropsSideEntries) {
+    PreciseLedger ledger;
+    ledger.fromJson(R"({"price":1.50,"values":[1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20]})");
+
+    ledger.beginObject();
+    ledger.setDouble("price", 2.5);
+    ledger.setInt64("values", 7);
+    ledger.endObject();
+
+    EXPECT_EQ(ledger.toJson(), "{\"price\":2.5,\"values\":7}");
+    EXPECT_EQ(ledger.getDecimal("price", 2), 250);
+    EXPECT_EQ(ledger.toJsonParallel(4), ledger.toJson());
+
+    Ledger plain;
+    plain.fromJson(R"({"price":1.50})");
+    plain.beginObject();
+    plain.setDouble("price", 2.5);
+    plain.endObject();
+    EXPECT_EQ(plain.getDecimal("price", 2), 250);
+}
+
+// setDecimal은 Begin/End 컨텍스트를 따름 (정확한 값은 루트에서만)
+TEST_F(DecimalTest, NestedContextSetDecimal) {
+    Ledger ledger;
+    ledger.beginObject("line");
+    ledger.setString("sku", "A");
+    EXPECT_FALSE(ledger.setDecimal("amount", 1999, 2));
+    ledger.endObject();
+
+    ledger.beginObject();
+    EXPECT_TRUE(ledger.setDecimal("total", 1999, 2));
+    ledger.endObject();
+
+    EXPECT_EQ(ledger.toJson(), "{\"line\":{\"sku\":\"A\",\"amount\":null},\"total\":19.99}");
+    EXPECT_EQ(ledger.getDecimal("total", 2), 1999);
+}
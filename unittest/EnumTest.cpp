@@ -0,0 +1,151 @@
+/**
+ * EnumTest.cpp - enum ↔ 문자열 테이블 테스트
+ *
+ * 테스트 영역:
+ * - setEnum/getEnum 라운드트립 (루트 / 배열 컨텍스트)
+ * - 촘촘한 값 / 흩어진 값 / 많은 이름의 완전 해시
+ * - 모르는 이름 / 목록에 없는 값 처리
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class EnumTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+enum class Status { Active, Paused, Closed };
+
+enum class Code : int32_t { Ok = 200, NotFound = 404, Teapot = 418, Internal = 500, Negative = -7, Large = 1 << 20 };
+
+enum Month { Jan = 1, Feb, Mar, Apr, May, Jun, Jul, Aug, Sep, Oct, Nov, Dec, MonthCount };
+
+} // namespace
+
+namespace json {
+
+template<>
+struct EnumTraits<Status> {
+    static constexpr EnumEntry<Status> entries[] = {
+        {Status::Active, "active"},
+        {Status::Paused, "paused"},
+        {Status::Closed, "closed"},
+    };
+};
+
+template<>
+struct EnumTraits<Code> {
+    static constexpr EnumEntry<Code> entries[] = {
+        {Code::Ok, "ok"},
+        {Code::NotFound, "not_found"},
+        {Code::Teapot, "teapot"},
+        {Code::Internal, "internal"},
+        {Code::Negative, "negative"},
+        {Code::Large, "large"},
+    };
+};
+
+template<>
+struct EnumTraits<Month> {
+    static constexpr EnumEntry<Month> entries[] = {
+        {Jan, "january"}, {Feb, "february"}, {Mar, "march"}, {Apr, "april"},
+        {May, "may"}, {Jun, "june"}, {Jul, "july"}, {Aug, "august"},
+        {Sep, "september"}, {Oct, "october"}, {Nov, "november"}, {Dec, "december"},
+        // 별칭: 디코드 전용 (인코드는 첫 항목)
+        {Jan, "jan"}, {Feb, "feb"}, {Dec, "dec"},
+    };
+};
+
+} // namespace json
+
+// 루트 / 배열 컨텍스트 라운드트립
+TEST_F(EnumTest, RoundTrip) {
+    class Ticket : public Jsonable {
+    public:
+        Status status = Status::Active;
+        Code code = Code::Ok;
+        std::vector<Month> months;
+
+        void loadFromJson() override {
+            status = getEnum("status", Status::Active);
+            code = getEnum<Code>("code");
+        }
+        void saveToJson() override {
+            setEnum("status", status);
+            setEnum("code", code);
+            beginArray("months");
+            for (Month m : months) setEnum("", m);
+            endArray();
+        }
+    };
+
+    Ticket ticket;
+    ticket.status = Status::Closed;
+    ticket.code = Code::Negative;
+    ticket.months = {Mar, Dec, Jan};
+
+    std::string json = ticket.toJson();
+    EXPECT_EQ(json, "{\"status\":\"closed\",\"code\":\"negative\",\"months\":[\"march\",\"december\",\"january\"]}");
+
+    Ticket loaded;
+    loaded.fromJson(json);
+    EXPECT_EQ(loaded.status, Status::Closed);
+    EXPECT_EQ(loaded.code, Code::Negative);
+}
+
+// 모든 이름 인코드/디코드 및 별칭
+TEST_F(EnumTest, AllNamesAndAliases) {
+    for (const auto& entry : EnumTraits<Month>::entries) {
+        Month decoded = MonthCount;
+        ASSERT_TRUE(parseEnum(entry.name, decoded)) << entry.name;
+        EXPECT_EQ(decoded, entry.value) << entry.name;
+    }
+    EXPECT_EQ(enumName(Jan), "january");
+    EXPECT_EQ(enumName(Dec), "december");
+
+    for (const auto& entry : EnumTraits<Code>::entries) {
+        EXPECT_EQ(enumName(entry.value), entry.name);
+    }
+}
+
+// 모르는 이름 / 목록에 없는 값
+TEST_F(EnumTest, UnknownNamesAndValues) {
+    class Holder : public Jsonable {
+    public:
+        void loadFromJson() override {}
+        void saveToJson() override {}
+    };
+
+    Holder holder;
+    holder.fromJson("{\"a\":\"ACTIVE\",\"b\":\"activ\",\"c\":\"activee\",\"d\":5,\"e\":\"\",\"f\":\"paused\"}");
+    EXPECT_EQ(holder.getEnum("a", Status::Closed), Status::Closed);
+    EXPECT_EQ(holder.getEnum("b", Status::Closed), Status::Closed);
+    EXPECT_EQ(holder.getEnum("c", Status::Closed), Status::Closed);
+    EXPECT_EQ(holder.getEnum("d", Status::Closed), Status::Closed);
+    EXPECT_EQ(holder.getEnum("e", Status::Closed), Status::Closed);
+    EXPECT_EQ(holder.getEnum("missing", Status::Paused), Status::Paused);
+    EXPECT_EQ(holder.getEnum("f", Status::Closed), Status::Paused);
+
+    Month month = Jun;
+    EXPECT_FALSE(parseEnum("june ", month));
+    EXPECT_FALSE(parseEnum("Dec", month));
+    EXPECT_EQ(month, Jun);
+
+    EXPECT_TRUE(enumName(static_cast<Code>(201)).empty());
+    EXPECT_TRUE(enumName(MonthCount).empty());
+
+    Holder written;
+    written.setEnum("code", static_cast<Code>(999));
+    written.setEnum("status", Status::Paused);
+    EXPECT_EQ(written.toJson(), "{\"code\":null,\"status\":\"paused\"}");
+
+    // 복사본도 이름 유지 (정적 리터럴 참조)
+    Holder copied(written);
+    EXPECT_EQ(copied.getEnum("status", Status::Active), Status::Paused);
+}
@@ -0,0 +1,172 @@
+/**
+ * FrozenTest.cpp - 고정 document 이미지 테스트
+ *
+ * 테스트 영역:
+ * - 이미지 생성 후 getter 결과가 Jsonable getter와 동일한지
+ * - 중첩 탐색, 중복 키, 빈 컨테이너
+ * - 파일/memfd 공개 후 다른 프로세스에서 읽기
+ * - 손상된 이미지 거부
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableFrozen.hpp"
+
+#if defined(JSONABLE_HAS_FROZEN)
+
+#include <sys/wait.h>
+#include <cstdlib>
+
+using namespace json;
+
+class FrozenTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class Config : public Jsonable {
+public:
+    void loadFromJson() override {}
+    void saveToJson() override {}
+};
+
+const char* kConfigJson =
+    "{\"host\":\"db.internal\",\"port\":5432,\"ratio\":0.75,\"debug\":false,"
+    "\"offset\":-12,\"big\":18446744073709551615,\"tags\":[\"a\",\"b\",\"c\"],"
+    "\"weights\":[1,2.5,-3],\"limits\":{\"rps\":1000,\"burst\":[10,20],\"empty\":{}},"
+    "\"none\":null,\"dup\":1,\"dup\":2,\"unicode\":\"안녕\"}";
+
+} // namespace
+
+// getter 결과가 Jsonable과 동일
+TEST_F(FrozenTest, GettersMatchJsonable) {
+    Config parsed;
+    parsed.fromJson(kConfigJson);
+
+    std::string image;
+    ASSERT_TRUE(freezeJson(kConfigJson, image));
+    FrozenDocument frozen;
+    ASSERT_TRUE(frozen.attach(image.data(), image.size()));
+
+    for (const char* key : {"host", "unicode", "missing", "port"}) {
+        EXPECT_EQ(frozen.getString(key, "x"), parsed.getString(key, "x")) << key;
+    }
+    for (const char* key : {"port", "offset", "big", "ratio", "host", "missing"}) {
+        EXPECT_EQ(frozen.getInt64(key, 7), parsed.getInt64(key, 7)) << key;
+        EXPECT_EQ(frozen.getUInt64(key, 7), parsed.getUInt64(key, 7)) << key;
+        EXPECT_EQ(frozen.getUInt32(key, 7), parsed.getUInt32(key, 7)) << key;
+        EXPECT_EQ(frozen.getDouble(key, 7.0), parsed.getDouble(key, 7.0)) << key;
+    }
+    EXPECT_EQ(frozen.getBool("debug", true), parsed.getBool("debug", true));
+    EXPECT_EQ(frozen.getArray<std::string>("tags"), parsed.getArray<std::string>("tags"));
+    EXPECT_EQ(frozen.getArray<double>("weights"), parsed.getArray<double>("weights"));
+    EXPECT_EQ(frozen.getInt64("dup"), parsed.getInt64("dup"));
+    EXPECT_TRUE(frozen.hasKey("none"));
+    EXPECT_TRUE(frozen.isObject("limits"));
+    EXPECT_TRUE(frozen.isArray("tags"));
+    EXPECT_FALSE(frozen.hasKey("absent"));
+
+    // 복사 없는 문자열 뷰는 이미지 안을 가리킴
+    const std::string_view host = frozen.getStringView("host");
+    EXPECT_EQ(host, "db.internal");
+    EXPECT_GE(host.data(), image.data());
+    EXPECT_LT(host.data(), image.data() + image.size());
+}
+
+// 중첩 탐색과 멤버 순회
+TEST_F(FrozenTest, NestedNavigation) {
+    std::string image;
+    ASSERT_TRUE(freezeJson(kConfigJson, image));
+    FrozenDocument frozen;
+    ASSERT_TRUE(frozen.attach(image.data(), image.size()));
+
+    const FrozenValue limits = frozen.root()["limits"];
+    EXPECT_EQ(limits["rps"].asInt64(), 1000);
+    EXPECT_EQ(limits["burst"][1].asInt64(), 20);
+    EXPECT_FALSE(limits["burst"][2].isValid());
+    EXPECT_TRUE(limits["empty"].isObject());
+    EXPECT_EQ(limits["empty"].size(), 0u);
+    EXPECT_FALSE(limits["rps"]["deeper"].isValid());
+
+    // 원래 멤버 순서 유지
+    const FrozenValue root = frozen.root();
+    ASSERT_EQ(root.size(), 13u);
+    EXPECT_EQ(root.memberName(0), "host");
+    EXPECT_EQ(root.memberName(12), "unicode");
+    EXPECT_EQ(root.memberValue(1).asInt64(), 5432);
+
+    std::string invalid;
+    EXPECT_FALSE(freezeJson("{\"broken\":", invalid));
+    EXPECT_TRUE(invalid.empty());
+}
+
+// 손상된 이미지 거부
+TEST_F(FrozenTest, RejectsCorruptImages) {
+    std::string image;
+    ASSERT_TRUE(freezeJson(kConfigJson, image));
+    FrozenDocument frozen;
+
+    EXPECT_FALSE(frozen.attach(image.data(), image.size() - 8));   // 크기 불일치
+
+    std::string badMagic = image;
+    badMagic[0] ^= 0x55;
+    EXPECT_FALSE(frozen.attach(badMagic.data(), badMagic.size()));
+
+    // 루트 객체의 첫 멤버 키 오프셋을 이미지 밖으로
+    std::string badOffset = image;
+    const size_t membersOffset = *reinterpret_cast<const uint64_t*>(badOffset.data() + 32 + 8);
+    const uint64_t outside = badOffset.size() + 64;
+    std::memcpy(&badOffset[membersOffset], &outside, sizeof(outside));
+    EXPECT_FALSE(frozen.attach(badOffset.data(), badOffset.size()));
+    EXPECT_FALSE(frozen.isOpen());
+}
+
+// 파일/memfd로 공개 후 다른 프로세스에서 매핑
+TEST_F(FrozenTest, SharedAcrossProcesses) {
+    Config config;
+    config.fromJson(kConfigJson);
+    std::string image;
+    ASSERT_TRUE(freeze(config, image));
+
+    const std::string path = "/tmp/jsonable_frozen_test_" + std::to_string(::getpid());
+    ASSERT_TRUE(writeFrozenFile(path, image));
+#if defined(__linux__) && defined(MFD_ALLOW_SEALING)
+    const int memfd = publishFrozenMemfd(image);
+    ASSERT_GE(memfd, 0);
+    EXPECT_LT(::write(memfd, "x", 1), 0);   // 봉인됨
+#else
+    const int memfd = -1;
+#endif
+
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        FrozenDocument fromFile;
+        if (!fromFile.open(path) || fromFile.getInt64("port") != 5432) ::_exit(1);
+        if (memfd >= 0) {
+            FrozenDocument fromMemfd;
+            if (!fromMemfd.openFd(memfd) || fromMemfd.root()["limits"]["rps"].asInt64() != 1000) ::_exit(2);
+        }
+        ::_exit(0);
+    }
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+
+    FrozenDocument moved;
+    {
+        FrozenDocument opened;
+        ASSERT_TRUE(opened.open(path));
+        moved = std::move(opened);
+    }
+    EXPECT_EQ(moved.getString("host"), "db.internal");
+
+    if (memfd >= 0) ::close(memfd);
+    ::unlink(path.c_str());
+}
+
+#endif // JSONABLE_HAS_FROZEN
@@ -0,0 +1,157 @@
+/**
+ * HotReloadTest.cpp - 파일 변경 감지 스냅샷 교체 테스트
+ *
+ * 테스트 영역:
+ * - 첫 로드, 직접 덮어쓰기/rename 교체 감지
+ * - 깨진 JSON, 검증 실패 시 기존 스냅샷 유지
+ * - 교체 중 동시 읽기와 이전 스냅샷 수명
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableHotReload.hpp"
+
+#if defined(JSONABLE_HAS_HOT_RELOAD)
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace json;
+
+class HotReloadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        char pattern[] = "/tmp/jsonable_reload_XXXXXX";
+        directory = mkdtemp(pattern);
+        path = directory + "/config.json";
+    }
+    void TearDown() override {
+        std::remove(path.c_str());
+        std::remove((path + ".tmp").c_str());
+        rmdir(directory.c_str());
+    }
+
+    std::string directory;
+    std::string path;
+};
+
+namespace {
+
+class Config : public Jsonable {
+public:
+    int64_t workers = 0;
+    std::string mode;
+
+    void loadFromJson() override {
+        workers = getInt64("workers");
+        mode = getString("mode");
+    }
+    void saveToJson() override {
+        setInt64("workers", workers);
+        setString("mode", mode);
+    }
+};
+
+void writeFile(const std::string& path, const std::string& text) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << text;
+}
+
+// 감시 스레드가 version을 올릴 때까지 대기
+bool waitForVersion(const HotReload<Config>& config, uint64_t version) {
+    for (int i = 0; i < 200; ++i) {
+        if (config.version() >= version) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_F(HotReloadTest, StartRequiresLoadableFile) {
+    HotReload<Config> config;
+    EXPECT_FALSE(config.start(path));
+    EXPECT_EQ(config.snapshot(), nullptr);
+
+    writeFile(path, R"({"workers":4,"mode":"fast"})");
+    ASSERT_TRUE(config.start(path));
+    EXPECT_TRUE(config.running());
+    EXPECT_EQ(config.version(), 1u);
+    EXPECT_EQ(config.snapshot()->workers, 4);
+    EXPECT_EQ(config.snapshot()->mode, "fast");
+}
+
+TEST_F(HotReloadTest, DetectsOverwriteAndRename) {
+    writeFile(path, R"({"workers":1,"mode":"a"})");
+    HotReload<Config> config;
+    ASSERT_TRUE(config.start(path));
+    auto first = config.snapshot();
+
+    writeFile(path, R"({"workers":2,"mode":"b"})");
+    ASSERT_TRUE(waitForVersion(config, 2));
+    EXPECT_EQ(config.snapshot()->workers, 2);
+
+    writeFile(path + ".tmp", R"({"workers":3,"mode":"c"})");
+    ASSERT_EQ(std::rename((path + ".tmp").c_str(), path.c_str()), 0);
+    ASSERT_TRUE(waitForVersion(config, 3));
+    EXPECT_EQ(config.snapshot()->mode, "c");
+
+    // 이전 스냅샷은 그대로 유효
+    EXPECT_EQ(first->workers, 1);
+    EXPECT_EQ(first->mode, "a");
+}
+
+TEST_F(HotReloadTest, KeepsSnapshotOnInvalidContent) {
+    writeFile(path, R"({"workers":8,"mode":"ok"})");
+    HotReload<Config> config;
+    config.setValidator([](const Config& c) { return c.workers > 0; });
+    ASSERT_TRUE(config.start(path));
+    config.stop();
+
+    writeFile(path, R"({"workers":9,"mode":)");
+    EXPECT_FALSE(config.reloadNow());
+    writeFile(path, R"({"workers":0,"mode":"bad"})");
+    EXPECT_FALSE(config.reloadNow());
+
+    EXPECT_EQ(config.failedReloads(), 2u);
+    EXPECT_EQ(config.version(), 1u);
+    EXPECT_EQ(config.snapshot()->workers, 8);
+}
+
+TEST_F(HotReloadTest, ConcurrentReadersDuringReloads) {
+    writeFile(path, R"({"workers":1,"mode":"m"})");
+    HotReload<Config> config;
+    ASSERT_TRUE(config.start(path));
+    config.stop();
+
+    std::atomic<bool> done{false};
+    std::atomic<int64_t> bad{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            int64_t last = 0;
+            while (!done) {
+                auto current = config.snapshot();
+                // 게시된 값은 단조 증가, 객체는 항상 완성 상태
+                if (!current || current->workers < last || current->mode != "m") ++bad;
+                else last = current->workers;
+            }
+        });
+    }
+
+    for (int i = 2; i <= 50; ++i) {
+        writeFile(path, R"({"workers":)" + std::to_string(i) + R"(,"mode":"m"})");
+        if (!config.reloadNow()) ++bad;
+    }
+    done = true;
+    for (auto& reader : readers) reader.join();
+
+    EXPECT_EQ(bad.load(), 0);
+    EXPECT_EQ(config.snapshot()->workers, 50);
+    EXPECT_EQ(config.version(), 50u);
+}
+
+#endif // JSONABLE_HAS_HOT_RELOAD
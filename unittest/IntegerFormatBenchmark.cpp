@@ -0,0 +1,64 @@
+/**
+ * IntegerFormatBenchmark.cpp - 정수 위주 payload 직렬화 벤치마크
+ *
+ * 비교 대상:
+ * - rapidjson::Writer (기존 출력 경로)
+ * - json::detail::JsonWriter (자릿수 선계산 + 2자리 표)
+ *
+ * Google Benchmark가 있을 때만 빌드됨 (jsonable_benchmark)
+ */
+
+#include <benchmark/benchmark.h>
+#include "../Jsonable.hpp"
+#include <random>
+
+namespace {
+
+// 카운터/ID 위주 document: 객체 배열, 필드마다 크기가 다른 정수
+rapidjson::Document makeCounters(size_t rows) {
+    rapidjson::Document document;
+    document.SetObject();
+    auto& allocator = document.GetAllocator();
+
+    std::mt19937_64 rng(42);
+    rapidjson::Value list(rapidjson::kArrayType);
+    for (size_t i = 0; i < rows; ++i) {
+        rapidjson::Value row(rapidjson::kObjectType);
+        row.AddMember("id", static_cast<uint64_t>(rng()), allocator);
+        row.AddMember("count", static_cast<int64_t>(rng() % 1000), allocator);
+        row.AddMember("bytes", static_cast<int64_t>(rng() % 100000000), allocator);
+        row.AddMember("delta", -static_cast<int64_t>(rng() % 100000), allocator);
+        list.PushBack(row, allocator);
+    }
+    document.AddMember("rows", list, allocator);
+    return document;
+}
+
+template<typename Writer>
+void serialize(benchmark::State& state) {
+    const rapidjson::Document document = makeCounters(static_cast<size_t>(state.range(0)));
+    size_t bytes = 0;
+    for (auto _ : state) {
+        rapidjson::StringBuffer buffer;
+        Writer writer(buffer);
+        document.Accept(writer);
+        bytes = buffer.GetSize();
+        benchmark::DoNotOptimize(buffer.GetString());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+void BM_RapidJsonWriter(benchmark::State& state) {
+    serialize<rapidjson::Writer<rapidjson::StringBuffer>>(state);
+}
+
+void BM_JsonWriter(benchmark::State& state) {
+    serialize<json::detail::JsonWriter<rapidjson::StringBuffer>>(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_RapidJsonWriter)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_JsonWriter)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,103 @@
+/**
+ * IntegerFormatTest.cpp - 정수 출력 경로 테스트
+ *
+ * 테스트 영역:
+ * - 자릿수 계산 (10^n 경계)
+ * - int64/uint64 극값 포맷
+ * - JsonWriter 출력이 std::to_string과 동일한지 (필드/배열/packed)
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableParallel.hpp"
+#include <limits>
+
+using namespace json;
+
+class IntegerFormatTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+std::string formatted(int64_t value) {
+    char text[detail::kMaxIntegerTextLength];
+    return std::string(text, detail::formatInt64(value, text));
+}
+
+std::string formatted(uint64_t value) {
+    char text[detail::kMaxIntegerTextLength];
+    return std::string(text, detail::formatUint64(value, text));
+}
+
+} // namespace
+
+// 10^n 경계 자릿수
+TEST_F(IntegerFormatTest, DigitCountBoundaries) {
+    EXPECT_EQ(detail::countDigits(0), 1u);
+    uint64_t power = 1;
+    for (unsigned digits = 1; digits <= 19; ++digits) {
+        EXPECT_EQ(detail::countDigits(power), digits) << power;
+        EXPECT_EQ(detail::countDigits(power * 10 - 1), digits) << power * 10 - 1;
+        power *= 10;
+    }
+    EXPECT_EQ(detail::countDigits(power), 20u);
+    EXPECT_EQ(detail::countDigits(std::numeric_limits<uint64_t>::max()), 20u);
+}
+
+// 극값과 경계값 포맷
+TEST_F(IntegerFormatTest, FormatsLimits) {
+    EXPECT_EQ(formatted(int64_t(0)), "0");
+    EXPECT_EQ(formatted(int64_t(-7)), "-7");
+    EXPECT_EQ(formatted(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(formatted(std::numeric_limits<int64_t>::max()), "9223372036854775807");
+    EXPECT_EQ(formatted(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+
+    uint64_t value = 1;
+    for (int i = 0; i < 64; ++i, value = value * 3 + 1) {
+        EXPECT_EQ(formatted(value), std::to_string(value));
+        EXPECT_EQ(formatted(-static_cast<int64_t>(value >> 1)), std::to_string(-static_cast<int64_t>(value >> 1)));
+    }
+}
+
+// Jsonable 직렬화 경로 전체 (필드, 컨텍스트 배열, packed 배열, 병렬)
+TEST_F(IntegerFormatTest, SerializationMatchesToString) {
+    class Counters : public Jsonable {
+    public:
+        std::vector<int64_t> samples;
+        std::vector<int64_t> packed;
+
+        void loadFromJson() override {}
+        void saveToJson() override {
+            setInt64("min", std::numeric_limits<int64_t>::min());
+            setUInt64("max", std::numeric_limits<uint64_t>::max());
+            setUInt32("zero", 0);
+            beginArray("samples");
+            for (int64_t v : samples) pushInt64(v);
+            endArray();
+            setArray("packed", packed);
+        }
+    };
+
+    std::vector<int64_t> values;
+    std::string expectedSamples;
+    int64_t v = 1;
+    for (int i = 0; i < 40; ++i, v = v * -7 + 3) {
+        values.push_back(v);
+        expectedSamples += (i ? "," : "") + std::to_string(v);
+    }
+
+    const std::string expected =
+        "{\"min\":-9223372036854775808,\"max\":18446744073709551615,\"zero\":0,"
+        "\"samples\":[" + expectedSamples + "],\"packed\":[" + expectedSamples + "]}";
+    // beginArray는 기존 배열에 이어 붙이므로 경로마다 새 객체 사용
+    Counters single;
+    single.samples = single.packed = values;
+    EXPECT_EQ(single.toJson(), expected);
+
+    Counters parallel;
+    parallel.samples = parallel.packed = values;
+    EXPECT_EQ(parallel.toJsonParallel(4), expected);
+}
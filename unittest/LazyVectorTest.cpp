@@ -0,0 +1,129 @@
+/**
+ * LazyVectorTest.cpp - 지연 구체화 벡터 테스트
+ *
+ * 테스트 영역:
+ * - fromJson(범위) 결과가 fromJson(문자열)과 동일한지
+ * - 배열/NDJSON 분할, 접근한 요소만 구체화
+ * - LRU 캐시 제한과 제거 후 재구체화
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class LazyVectorTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+int loadCount = 0;
+
+class Item : public Jsonable {
+public:
+    int64_t id = 0;
+    std::string label;
+    std::vector<int64_t> values;
+
+    void loadFromJson() override {
+        ++loadCount;
+        id = getInt64("id");
+        label = getString("label");
+        values = getArray<int64_t>("values");
+    }
+    void saveToJson() override {
+        setInt64("id", id);
+        setString("label", label);
+        setArray("values", values);
+    }
+};
+
+} // namespace
+
+// 범위 파싱: 범위 밖은 읽지 않음
+TEST_F(LazyVectorTest, FromJsonRangeMatchesString) {
+    const std::string record = R"({"id":7,"label":"a,b]}","values":[1,2,3]})";
+    const std::string buffer = record + R"(GARBAGE{"id":8})";
+
+    Item fromString;
+    fromString.fromJson(record);
+    Item fromRange;
+    fromRange.fromJson(buffer.data(), record.size());
+
+    EXPECT_EQ(fromRange.id, 7);
+    EXPECT_EQ(fromRange.label, "a,b]}");
+    EXPECT_EQ(fromRange.values, fromString.values);
+    EXPECT_EQ(fromRange.toJson(), fromString.toJson());
+}
+
+// 접근한 요소만 구체화
+TEST_F(LazyVectorTest, MaterializesOnlyAccessedElements) {
+    LazyVector<Item> items;
+    ASSERT_TRUE(items.assignArray(R"( [ {"id":1,"label":"x"} , {"id":2,"label":"[\"]"},{"id":3,"values":[4,5]} ] )"));
+    ASSERT_EQ(items.size(), 3u);
+    EXPECT_EQ(items.raw(1), R"({"id":2,"label":"[\"]"})");
+
+    loadCount = 0;
+    const auto second = items.get(1);
+    ASSERT_TRUE(second);
+    EXPECT_EQ(second->label, "[\"]");
+    EXPECT_EQ(items.get(1), second);   // 같은 객체 재사용
+    EXPECT_EQ(loadCount, 1);
+    EXPECT_EQ(items.materializedCount(), 1u);
+    EXPECT_FALSE(items.isMaterialized(0));
+    EXPECT_EQ(items[2]->values, std::vector<int64_t>({4, 5}));
+    EXPECT_EQ(items.get(3), nullptr);
+
+    Item copy;
+    EXPECT_TRUE(items.load(0, copy));
+    EXPECT_EQ(copy.id, 1);
+    EXPECT_FALSE(items.isMaterialized(0));
+
+    EXPECT_TRUE(items.assignArray("[]"));
+    EXPECT_TRUE(items.empty());
+    for (const char* bad : {"{}", "[1,", "[1 2]", "[1]x", "[\"open]"}) {
+        EXPECT_FALSE(items.assignArray(bad)) << bad;
+    }
+}
+
+// LRU 제한: 최근 접근한 요소만 유지, 밀려난 객체도 받은 쪽에서는 유효
+TEST_F(LazyVectorTest, BoundedCacheEvictsLeastRecentlyUsed) {
+    std::string ndjson;
+    for (int i = 0; i < 10; ++i) {
+        Item item;
+        item.id = i;
+        item.label = "item" + std::to_string(i);
+        ndjson += item.toJson() + "\r\n";
+        if (i == 4) ndjson += "\n   \n";
+    }
+
+    LazyVector<Item> items(3);
+    items.assignNdjson(ndjson);
+    ASSERT_EQ(items.size(), 10u);
+
+    const auto zero = items.get(0);
+    items.get(1);
+    items.get(2);
+    items.get(0);   // 0을 최근으로
+    items.get(3);   // 1이 밀려남
+    EXPECT_EQ(items.materializedCount(), 3u);
+    EXPECT_TRUE(items.isMaterialized(0));
+    EXPECT_FALSE(items.isMaterialized(1));
+    EXPECT_TRUE(items.isMaterialized(2));
+
+    for (size_t i = 4; i < 10; ++i) EXPECT_EQ(items.get(i)->id, static_cast<int64_t>(i));
+    EXPECT_EQ(items.materializedCount(), 3u);
+    EXPECT_FALSE(items.isMaterialized(0));
+    EXPECT_EQ(zero->label, "item0");
+
+    loadCount = 0;
+    EXPECT_EQ(items.get(1)->label, "item1");
+    EXPECT_EQ(loadCount, 1);
+
+    items.dropCache();
+    EXPECT_EQ(items.materializedCount(), 0u);
+    EXPECT_EQ(items.get(9)->id, 9);
+}
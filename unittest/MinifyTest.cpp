@@ -0,0 +1,111 @@
+/**
+ * MinifyTest.cpp - 제자리 JSON 압축 테스트
+ *
+ * 테스트 영역:
+ * - 들여쓰기/줄바꿈 제거, 문자열 내부 공백 보존
+ * - 이스케이프된 따옴표/역슬래시와 블록 경계 위치
+ * - fromJson() + toJson() 결과와의 동일성
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class MinifyTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class Passthrough : public Jsonable {
+public:
+    void loadFromJson() override {}
+    void saveToJson() override {}
+};
+
+// 바이트 단위 기준 구현
+std::string referenceMinify(const std::string& text) {
+    std::string out;
+    bool inString = false;
+    for (size_t i = 0; i < text.size(); ++i) {
+        const char c = text[i];
+        if (inString) {
+            out += c;
+            if (c == '\\' && i + 1 < text.size()) {
+                out += text[++i];
+            } else if (c == '"') {
+                inString = false;
+            }
+        } else if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            out += c;
+            if (c == '"') inString = true;
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+// 기본 압축: 문자열 내부 공백 보존
+TEST_F(MinifyTest, StripsWhitespaceOutsideStrings) {
+    std::string text =
+        "{\r\n"
+        "    \"name\" : \"hello   world\",\n"
+        "\t\"list\": [ 1, 2 ,\t3 ],\n"
+        "    \"nested\": { \"empty\": { }, \"flag\" : true }\n"
+        "}\n";
+
+    minify(text);
+    EXPECT_EQ(text, "{\"name\":\"hello   world\",\"list\":[1,2,3],\"nested\":{\"empty\":{},\"flag\":true}}");
+
+    std::string empty;
+    minify(empty);
+    EXPECT_TRUE(empty.empty());
+
+    std::string blank = " \n\t\r  ";
+    minify(blank);
+    EXPECT_TRUE(blank.empty());
+}
+
+// 이스케이프와 블록 경계: 모든 정렬 위치에서 기준 구현과 동일
+TEST_F(MinifyTest, EscapesAtEveryAlignment) {
+    const std::string body =
+        "{ \"a \\\" b\" : \"x\\\\\" ,  \"c\\\\\\\"  d\" : [ \"  \\\\\\\\ \" , \"\\u0020 \" ] ,"
+        "\n  \"long string with    many spaces and no escapes at all\"  :  null }";
+
+    for (size_t pad = 0; pad < 40; ++pad) {
+        std::string text = std::string(pad, ' ') + body + std::string(pad % 7, '\n');
+        std::string expected = referenceMinify(text);
+
+        std::vector<char> buffer(text.begin(), text.end());
+        size_t length = minify(buffer.data(), buffer.size());
+        EXPECT_EQ(std::string(buffer.data(), length), expected) << "pad=" << pad;
+    }
+
+    // 버퍼 끝에서 끝나는 이스케이프 (잘못된 입력도 범위 밖 접근 없음)
+    std::string truncated = "[\"abc\\";
+    minify(truncated);
+    EXPECT_EQ(truncated, "[\"abc\\");
+}
+
+// 파싱 후 재직렬화 결과와 동일
+TEST_F(MinifyTest, MatchesParseAndSerialize) {
+    std::string pretty = "{\n";
+    for (int i = 0; i < 200; ++i) {
+        pretty += "    \"key" + std::to_string(i) + "\" : {\n";
+        pretty += "        \"text\" : \"value \\\"" + std::to_string(i) + "\\\" \\\\ end\",\n";
+        pretty += "        \"values\" : [ " + std::to_string(i) + " , -" + std::to_string(i * 3 + 1) + " , true , null ]\n";
+        pretty += i + 1 < 200 ? "    },\n" : "    }\n";
+    }
+    pretty += "}\n";
+
+    Passthrough obj;
+    obj.fromJson(pretty);
+
+    std::string minified = pretty;
+    minify(minified);
+    EXPECT_EQ(minified, obj.toJson());
+}
@@ -0,0 +1,228 @@
+/**
+ * PackedArrayTest.cpp - 숫자 배열 packed 경로 테스트
+ *
+ * 테스트 영역:
+ * - SWAR 숫자 변환 커널 정확도
+ * - 파싱 시 숫자 배열 → 연속 버퍼 변환 및 getArray 결과
+ * - 라운드트립 / 혼합 배열 폴백 / 값 덮어쓰기 / 복사
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableParallel.hpp"
+#include <cstdlib>
+
+using namespace json;
+
+class PackedArrayTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class Passthrough : public Jsonable {
+public:
+    void loadFromJson() override {}
+    void saveToJson() override {}
+};
+
+std::string numberList(size_t count, const std::function<std::string(size_t)>& gen) {
+    std::string out = "[";
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) out += ",";
+        out += gen(i);
+    }
+    return out + "]";
+}
+
+} // namespace
+
+// SWAR 커널: 정수/실수 분류와 값 정확도
+TEST_F(PackedArrayTest, NumberKernelAccuracy) {
+    const char* doubles[] = {
+        "0.0", "1.5", "-2.25", "3.14159265358979", "123456789.123456789", "1e10", "1E-5",
+        "-0.000001", "2.2250738585072014e-308", "1.7976931348623157e308", "12345678901234567890.5",
+        "0.1", "9007199254740993.0", "4.9e-324"
+    };
+    for (const char* text : doubles) {
+        detail::ParsedNumber n;
+        ASSERT_TRUE(detail::parseNumber(text, strlen(text), n)) << text;
+        EXPECT_EQ(n.kind, detail::ParsedNumber::Kind::Double) << text;
+        EXPECT_EQ(n.d, std::strtod(text, nullptr)) << text;
+    }
+
+    detail::ParsedNumber n;
+    ASSERT_TRUE(detail::parseNumber("12345678", 8, n));
+    EXPECT_EQ(n.kind, detail::ParsedNumber::Kind::UInt64);
+    EXPECT_EQ(n.u, 12345678u);
+
+    ASSERT_TRUE(detail::parseNumber("18446744073709551615", 20, n));
+    EXPECT_EQ(n.kind, detail::ParsedNumber::Kind::UInt64);
+    EXPECT_EQ(n.u, UINT64_MAX);
+
+    ASSERT_TRUE(detail::parseNumber("-9223372036854775808", 20, n));
+    EXPECT_EQ(n.kind, detail::ParsedNumber::Kind::Int64);
+    EXPECT_EQ(n.i, INT64_MIN);
+
+    ASSERT_TRUE(detail::parseNumber("-9223372036854775809", 20, n));
+    EXPECT_EQ(n.kind, detail::ParsedNumber::Kind::Double);
+
+    EXPECT_FALSE(detail::parseNumber("1e400", 5, n));
+}
+
+// 큰 숫자 배열 파싱 → getArray
+TEST_F(PackedArrayTest, ParsesLargeNumericArrays) {
+    class Series : public Jsonable {
+    public:
+        std::vector<double> samples;
+        std::vector<int64_t> ids;
+        std::vector<int> small;
+
+        void loadFromJson() override {
+            samples = getArray<double>("samples");
+            ids = getArray<int64_t>("ids");
+            small = getArray<int>("ids");
+        }
+        void saveToJson() override {}
+    };
+
+    const size_t count = 20000;
+    std::string json = "{\"samples\":" +
+        numberList(count, [](size_t i) { return std::to_string(i) + ".25"; }) +
+        ",\"ids\":" +
+        numberList(count, [](size_t i) { return std::to_string(static_cast<int64_t>(i) * 1000003 - 5000000); }) +
+        "}";
+
+    Series series;
+    series.fromJson(json);
+
+    ASSERT_EQ(series.samples.size(), count);
+    ASSERT_EQ(series.ids.size(), count);
+    ASSERT_EQ(series.small.size(), count);
+    for (size_t i = 0; i < count; i += 997) {
+        EXPECT_DOUBLE_EQ(series.samples[i], static_cast<double>(i) + 0.25);
+        EXPECT_EQ(series.ids[i], static_cast<int64_t>(i) * 1000003 - 5000000);
+        EXPECT_EQ(series.small[i], static_cast<int>(series.ids[i]));
+    }
+
+    EXPECT_TRUE(series.isArray("samples"));
+    size_t visited = 0;
+    series.iterateArray("ids", [&visited](size_t) { ++visited; });
+    EXPECT_EQ(visited, count);
+}
+
+// 라운드트립: 원문과 동일한 출력
+TEST_F(PackedArrayTest, RoundTripPreservesText) {
+    std::string json = "{\"a\":" + numberList(64, [](size_t i) { return std::to_string(i * 7); }) +
+                       ",\"b\":" + numberList(40, [](size_t i) { return std::to_string(i) + ".5"; }) +
+                       ",\"mixed\":" + numberList(32, [](size_t i) { return i % 2 ? "1" : "2.5"; }) +
+                       ",\"tail\":" + numberList(20, [](size_t i) { return i == 19 ? std::string("\"x\"") : std::to_string(i); }) +
+                       ",\"nested\":[[1,2],[3,4]],\"neg\":" +
+                       numberList(30, [](size_t i) { return "-" + std::to_string((i + 1) * 100000000000ULL); }) + "}";
+
+    Passthrough obj;
+    obj.fromJson(json);
+    EXPECT_EQ(obj.toJson(), json);
+    EXPECT_EQ(obj.toJsonParallel(4), json);
+
+    // 혼합 배열은 일반 DOM 경로로 처리되어도 값은 동일
+    auto mixed = obj.getArray<double>("mixed");
+    ASSERT_EQ(mixed.size(), 32u);
+    EXPECT_DOUBLE_EQ(mixed[0], 2.5);
+    EXPECT_DOUBLE_EQ(mixed[1], 1.0);
+}
+
+// 값 덮어쓰기 및 복사 시 packed 상태 유지/제거
+TEST_F(PackedArrayTest, OverwriteAndCopy) {
+    std::string json = "{\"values\":" + numberList(100, [](size_t i) { return std::to_string(i); }) + "}";
+
+    Passthrough original;
+    original.fromJson(json);
+
+    Passthrough copied(original);
+    EXPECT_EQ(copied.getArray<int64_t>("values").size(), 100u);
+    EXPECT_EQ(copied.toJson(), json);
+
+    original.setInt64("values", 7);
+    EXPECT_EQ(original.getInt64("values"), 7);
+    EXPECT_TRUE(original.getArray<int64_t>("values").empty());
+    EXPECT_EQ(original.toJson(), "{\"values\":7}");
+
+    Passthrough assigned;
+    assigned = copied;
+    EXPECT_EQ(assigned.toJson(), json);
+
+    std::vector<int64_t> replacement = {1, 2, 3};
+    assigned.setArray("values", replacement);
+    EXPECT_EQ(assigned.getArray<int64_t>("values"), replacement);
+    EXPECT_EQ(assigned.toJson(), "{\"values\":[1,2,3]}");
+}
+
+// setArray: 큰 숫자 벡터는 packed 저장, 출력은 DOM 경로와 동일
+TEST_F(PackedArrayTest, SetArrayUsesPackedStorage) {
+    class Packed : public Jsonable {
+    public:
+        std::vector<double> doubles;
+        std::vector<uint32_t> counters;
+        std::vector<uint64_t> big;
+        std::vector<float> floats;
+
+        void loadFromJson() override {}
+        void saveToJson() override {
+            setArray("doubles", doubles);
+            setArray("counters", counters);
+            setArray("big", big);
+            setArray("floats", floats);
+        }
+    };
+
+    // 같은 값을 Begin/End 방식(요소별 DOM)으로 생성하여 비교
+    class Reference : public Jsonable {
+    public:
+        const Packed* source = nullptr;
+
+        void loadFromJson() override {}
+        void saveToJson() override {
+            beginArray("doubles");
+            for (double v : source->doubles) pushDouble(v);
+            endArray();
+            beginArray("counters");
+            for (uint32_t v : source->counters) setUInt32("", v);
+            endArray();
+            beginArray("big");
+            for (uint64_t v : source->big) setUInt64("", v);
+            endArray();
+            beginArray("floats");
+            for (float v : source->floats) setFloat("", v);
+            endArray();
+        }
+    };
+
+    Packed packed;
+    for (size_t i = 0; i < 1000; ++i) {
+        packed.doubles.push_back(static_cast<double>(i) / 8.0);
+        packed.counters.push_back(static_cast<uint32_t>(i * 4000000u));
+        packed.big.push_back(i == 500 ? UINT64_MAX : i);
+        packed.floats.push_back(static_cast<float>(i) * 0.5f);
+    }
+
+    Reference reference;
+    reference.source = &packed;
+
+    std::string json = packed.toJson();
+    EXPECT_EQ(json, reference.toJson());
+
+    EXPECT_EQ(packed.getArray<double>("doubles"), packed.doubles);
+    EXPECT_EQ(packed.getArray<uint32_t>("counters"), packed.counters);
+    EXPECT_EQ(packed.getArray<uint64_t>("big"), packed.big);
+    EXPECT_EQ(packed.getArray<float>("floats"), packed.floats);
+
+    // 파싱 경로: 0..UINT32_MAX 정수 배열은 uint32로 축소되어도 값/출력 동일
+    Passthrough parsed;
+    parsed.fromJson(json);
+    EXPECT_EQ(parsed.getArray<uint32_t>("counters"), packed.counters);
+    EXPECT_EQ(parsed.getArray<int64_t>("counters").back(), static_cast<int64_t>(packed.counters.back()));
+    EXPECT_EQ(parsed.toJson(), json);
+}
@@ -0,0 +1,195 @@
+/**
+ * ParallelSerializationTest.cpp - 병렬 직렬화 테스트
+ *
+ * 테스트 영역:
+ * - toJsonParallel() 결과가 toJson()과 동일한지 검증
+ * - 대형 중첩 트리 (카테고리 × 항목) 분할 직렬화
+ * - 작은 document / 특수 문자 키 처리
+ * - 분할 기준 (추정 작업량), 풀 스레드 재사용, 작업 예외 전달
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableParallel.hpp"
+
+#include <set>
+#include <stdexcept>
+
+using namespace json;
+
+class ParallelSerializationTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+// 카테고리마다 많은 항목을 가진 카탈로그
+class Catalog : public Jsonable {
+public:
+    size_t categoryCount = 0;
+    size_t itemCount = 0;
+
+    void loadFromJson() override {}
+
+    void saveToJson() override {
+        beginObject();
+        {
+            setString("name", "catalog");
+            setInt64("version", 3);
+
+            beginArray("categories");
+            {
+                for (size_t c = 0; c < categoryCount; ++c) {
+                    beginObject();
+                    {
+                        setString("title", "category-" + std::to_string(c));
+
+                        beginArray("items");
+                        {
+                            for (size_t i = 0; i < itemCount; ++i) {
+                                beginObject();
+                                {
+                                    setInt64("id", static_cast<int64_t>(c * itemCount + i));
+                                    setString("label", "item \"" + std::to_string(i) + "\"");
+                                    setDouble("price", 0.5 * static_cast<double>(i));
+                                    setBool("stock", i % 2 == 0);
+                                }
+                                endObject();
+                            }
+                        }
+                        endArray();
+                    }
+                    endObject();
+                }
+            }
+            endArray();
+        }
+        endObject();
+    }
+};
+
+} // namespace
+
+// 대형 트리 병렬 직렬화 결과 동일성
+TEST_F(ParallelSerializationTest, LargeTreeMatchesSequential) {
+    Catalog catalog;
+    catalog.categoryCount = 120;
+    catalog.itemCount = 150;
+
+    std::string sequential = catalog.toJson();
+
+    Catalog parallelCatalog;
+    parallelCatalog.categoryCount = 120;
+    parallelCatalog.itemCount = 150;
+
+    EXPECT_EQ(parallelCatalog.toJsonParallel(4), sequential);
+}
+
+// 스레드 수 변화와 무관하게 동일한 결과
+TEST_F(ParallelSerializationTest, ThreadCountIndependent) {
+    for (size_t threads : {1, 2, 3, 8, 0}) {
+        Catalog catalog;
+        catalog.categoryCount = 70;
+        catalog.itemCount = 80;
+
+        Catalog reference;
+        reference.categoryCount = 70;
+        reference.itemCount = 80;
+
+        EXPECT_EQ(catalog.toJsonParallel(threads), reference.toJson()) << "threads=" << threads;
+    }
+}
+
+// 작은 document 및 빈 document
+TEST_F(ParallelSerializationTest, SmallDocuments) {
+    class Small : public Jsonable {
+    public:
+        bool empty = false;
+        void loadFromJson() override {}
+        void saveToJson() override {
+            if (empty) return;
+            setString("key \"with\" quotes", "value\n");
+            setInt64("n", 42);
+        }
+    };
+
+    Small small;
+    EXPECT_EQ(small.toJsonParallel(4), small.toJson());
+
+    Small empty;
+    empty.empty = true;
+    EXPECT_EQ(empty.toJsonParallel(4), "{}");
+}
+
+// 파싱된 document의 라운드트립
+TEST_F(ParallelSerializationTest, ParsedDocumentRoundTrip) {
+    class Passthrough : public Jsonable {
+    public:
+        void loadFromJson() override {}
+        void saveToJson() override {}
+    };
+
+    std::string json = "{\"a\":[";
+    for (int i = 0; i < 500; ++i) {
+        if (i > 0) json += ",";
+        json += "{\"k\":" + std::to_string(i) + ",\"v\":[1,2,3]}";
+    }
+    json += "],\"b\":{\"x\":\"y\"},\"c\":null}";
+
+    Passthrough obj;
+    obj.fromJson(json);
+
+    EXPECT_EQ(obj.toJsonParallel(3), json);
+}
+
+// 자식 수가 아니라 추정 작업량으로 분할 여부 결정
+TEST_F(ParallelSerializationTest, SplitsOnlyLargeDocuments) {
+    rapidjson::Document small;
+    small.Parse(R"({"a":[1,2,3],"b":{"c":"d"},"e":null})");
+    EXPECT_FALSE(detail::ParallelSerializer::worthSplitting(small));
+
+    std::string json = "[";
+    for (int i = 0; i < 10000; ++i) {
+        if (i > 0) json += ",";
+        json += "{\"k\":" + std::to_string(i) + "}";
+    }
+    json += "]";
+    rapidjson::Document large;
+    large.Parse(json.c_str());
+    EXPECT_TRUE(detail::ParallelSerializer::worthSplitting(large));
+
+    rapidjson::Document scalar;
+    scalar.Parse("\"text\"");
+    EXPECT_FALSE(detail::ParallelSerializer::worthSplitting(scalar));
+}
+
+// 워커 스레드는 run() 사이에 재사용되고 작업 예외는 호출 스레드로 전달
+TEST_F(ParallelSerializationTest, PoolReusesThreadsAndRethrows) {
+    detail::WorkStealingPool pool(4);
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    for (int round = 0; round < 5; ++round) {
+        pool.run(64, [&](size_t) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            std::lock_guard<std::mutex> lock(mutex);
+            threads.insert(std::this_thread::get_id());
+        });
+    }
+    EXPECT_LE(threads.size(), 4u);
+
+    std::atomic<size_t> ran{0};
+    EXPECT_THROW(pool.run(1000, [&](size_t index) {
+        ++ran;
+        if (index == 3) throw std::runtime_error("task failed");
+    }), std::runtime_error);
+    EXPECT_LT(ran.load(), 1000u);   // 실패 후 남은 작업은 건너뜀
+
+    // 작업 안에서 다시 run()을 호출하면 호출 스레드가 혼자 처리
+    std::vector<int> counts(8, 0);
+    pool.run(8, [&](size_t outer) {
+        pool.run(10, [&](size_t) { ++counts[outer]; });
+    });
+    EXPECT_EQ(counts, std::vector<int>(8, 10));
+}
@@ -0,0 +1,199 @@
+/**
+ * PersistentTest.cpp - 구조 공유 불변 document 테스트
+ *
+ * 테스트 영역:
+ * - 수정 후 이전 버전 불변, 건드리지 않은 하위 트리 공유
+ * - JSON Pointer 경로 (이스케이프, 배열 인덱스, "-")
+ * - 삭제, 하위 트리 설정, 잘못된 경로
+ * - Jsonable 객체와의 변환
+ * - 큰 배열/객체 (트라이 노드, 키 색인, 삭제 후 압축)
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class PersistentTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+const char* kState =
+    "{\"users\":[{\"name\":\"kim\",\"age\":30},{\"name\":\"lee\",\"age\":41}],"
+    "\"meta\":{\"version\":1,\"tags\":[\"a\",\"b\"],\"a/b\":true,\"m~n\":2},"
+    "\"big\":18446744073709551615,\"ratio\":0.5,\"none\":null}";
+
+class Profile : public Jsonable {
+public:
+    std::string name;
+    int64_t age = 0;
+
+    void loadFromJson() override {
+        name = getString("name");
+        age = getInt64("age");
+    }
+    void saveToJson() override {
+        setString("name", name);
+        setInt64("age", age);
+    }
+};
+
+} // namespace
+
+// 새 버전은 경로만 새로 만들고 나머지는 공유
+TEST_F(PersistentTest, UpdateSharesUntouchedSubtrees) {
+    PersistentDocument v1;
+    ASSERT_TRUE(v1.parse(kState));
+    EXPECT_EQ(v1.toJson(), kState);
+
+    PersistentDocument v2 = v1;
+    ASSERT_TRUE(v2.setInt64("/users/1/age", 42));
+
+    EXPECT_EQ(v1.getInt64("/users/1/age"), 41);
+    EXPECT_EQ(v2.getInt64("/users/1/age"), 42);
+    EXPECT_TRUE(v1.sharesSubtree(v2, "/meta"));
+    EXPECT_TRUE(v1.sharesSubtree(v2, "/users/0"));
+    EXPECT_TRUE(v1.sharesSubtree(v2, "/users/1/name"));
+    EXPECT_FALSE(v1.sharesSubtree(v2, "/users/1"));
+    EXPECT_FALSE(v1.sharesSubtree(v2, "/users"));
+    EXPECT_FALSE(v1.sharesSubtree(v2, ""));
+
+    // 여러 버전 이력
+    std::vector<PersistentDocument> history{v1};
+    for (int version = 2; version <= 50; ++version) {
+        PersistentDocument next = history.back();
+        ASSERT_TRUE(next.setInt64("/meta/version", version));
+        history.push_back(next);
+    }
+    for (int version = 1; version <= 50; ++version) {
+        EXPECT_EQ(history[version - 1].getInt64("/meta/version"), version);
+    }
+    EXPECT_TRUE(history.front().sharesSubtree(history.back(), "/users"));
+    EXPECT_TRUE(history.front().sharesSubtree(history.back(), "/meta/tags"));
+}
+
+// getter와 JSON Pointer 규칙
+TEST_F(PersistentTest, PointerAccess) {
+    PersistentDocument doc;
+    ASSERT_TRUE(doc.parse(kState));
+
+    EXPECT_EQ(doc.getString("/users/0/name"), "kim");
+    EXPECT_EQ(doc.getString("/users/2/name", "none"), "none");
+    EXPECT_EQ(doc.getString("/users/01/name", "bad"), "bad");
+    EXPECT_TRUE(doc.getBool("/meta/a~1b"));
+    EXPECT_EQ(doc.getInt64("/meta/m~0n"), 2);
+    EXPECT_EQ(doc.getUInt64("/big"), 18446744073709551615ULL);
+    EXPECT_DOUBLE_EQ(doc.getDouble("/ratio"), 0.5);
+    EXPECT_EQ(doc.getInt64("/ratio"), 0);
+    EXPECT_TRUE(doc.isNull("/none"));
+    EXPECT_TRUE(doc.isArray("/meta/tags"));
+    EXPECT_TRUE(doc.isObject(""));
+    EXPECT_EQ(doc.size("/users"), 2u);
+    EXPECT_EQ(doc.keys("/users/0"), std::vector<std::string>({"name", "age"}));
+    EXPECT_FALSE(doc.has("users"));      // '/'로 시작해야 함
+    EXPECT_FALSE(doc.has("/meta/~2"));
+    EXPECT_EQ(doc.toJson("/meta/tags"), "[\"a\",\"b\"]");
+}
+
+// 생성/삭제/하위 트리
+TEST_F(PersistentTest, SetEraseAndSubtrees) {
+    PersistentDocument base;
+    ASSERT_TRUE(base.parse(kState));
+    PersistentDocument doc = base;
+
+    EXPECT_TRUE(doc.setString("/owner/team/name", "core"));   // 중간 객체 생성
+    EXPECT_TRUE(doc.setString("/meta/tags/-", "c"));           // 배열 끝 추가
+    EXPECT_TRUE(doc.setBool("/meta/tags/0", false));
+    EXPECT_FALSE(doc.setInt64("/meta/tags/9", 1));              // 범위 밖
+    EXPECT_FALSE(doc.setInt64("/ratio/x", 1));                  // 스칼라 통과
+    EXPECT_TRUE(doc.setJson("/users/-", "{\"name\":\"park\",\"age\":25}"));
+    EXPECT_FALSE(doc.setJson("/users/-", "{broken"));
+
+    EXPECT_EQ(doc.getString("/owner/team/name"), "core");
+    EXPECT_EQ(doc.toJson("/meta/tags"), "[false,\"b\",\"c\"]");
+    EXPECT_EQ(doc.getInt64("/users/2/age"), 25);
+
+    EXPECT_TRUE(doc.erase("/users/0"));
+    EXPECT_FALSE(doc.erase("/users/5"));
+    EXPECT_FALSE(doc.erase("/missing"));
+    EXPECT_FALSE(doc.erase(""));
+    EXPECT_TRUE(doc.erase("/none"));
+    EXPECT_EQ(doc.getString("/users/0/name"), "lee");
+    EXPECT_FALSE(doc.has("/none"));
+
+    // 다른 버전의 하위 트리를 그대로 가져옴
+    EXPECT_TRUE(doc.setSubtree("/archived", base, "/users"));
+    EXPECT_EQ(doc.toJson("/archived"), base.toJson("/users"));
+
+    EXPECT_EQ(base.toJson(), kState);   // 원본 불변
+}
+
+// 32개를 넘는 컨테이너: 트라이 경로만 새로 만들고 형제 요소는 공유
+TEST_F(PersistentTest, LargeContainers) {
+    std::string json = "{\"items\":[";
+    for (int i = 0; i < 2000; ++i) json += (i ? "," : "") + std::to_string(i);
+    json += "],\"table\":{";
+    for (int i = 0; i < 2000; ++i) json += (i ? ",\"k" : "\"k") + std::to_string(i) + "\":{\"v\":" + std::to_string(i) + "}";
+    json += "}}";
+
+    PersistentDocument v1;
+    ASSERT_TRUE(v1.parse(json));
+    EXPECT_EQ(v1.toJson(), json);
+
+    PersistentDocument v2 = v1;
+    ASSERT_TRUE(v2.setInt64("/items/1500", -1));
+    ASSERT_TRUE(v2.setInt64("/table/k1700/v", -2));
+    ASSERT_TRUE(v2.setInt64("/items/-", 2000));
+    ASSERT_TRUE(v2.setString("/table/extra", "x"));
+
+    EXPECT_EQ(v1.getInt64("/items/1500"), 1500);
+    EXPECT_EQ(v2.getInt64("/items/1500"), -1);
+    EXPECT_EQ(v2.getInt64("/items/2000"), 2000);
+    EXPECT_EQ(v2.size("/items"), 2001u);
+    EXPECT_EQ(v1.getInt64("/table/k1700/v"), 1700);
+    EXPECT_EQ(v2.getInt64("/table/k1700/v"), -2);
+    EXPECT_EQ(v2.getString("/table/extra"), "x");
+    EXPECT_TRUE(v1.sharesSubtree(v2, "/table/k1699"));
+    EXPECT_FALSE(v1.sharesSubtree(v2, "/table/k1700"));
+    EXPECT_EQ(v1.toJson(), json);
+
+    // 큰 객체 삭제: 순서 유지, 같은 키를 다시 넣으면 끝에 추가
+    PersistentDocument v3 = v2;
+    for (int i = 0; i < 1990; ++i) ASSERT_TRUE(v3.erase("/table/k" + std::to_string(i)));
+    EXPECT_FALSE(v3.erase("/table/k5"));
+    EXPECT_FALSE(v3.has("/table/k5"));
+    EXPECT_EQ(v3.size("/table"), 11u);
+    ASSERT_TRUE(v3.setInt64("/table/k5", 5));
+    EXPECT_EQ(v3.keys("/table").front(), "k1990");
+    EXPECT_EQ(v3.keys("/table").back(), "k5");
+    EXPECT_EQ(v3.getInt64("/table/k1995/v"), 1995);
+    EXPECT_EQ(v2.size("/table"), 2001u);
+
+    // 큰 배열 중간 삭제
+    ASSERT_TRUE(v3.erase("/items/0"));
+    EXPECT_EQ(v3.getInt64("/items/0"), 1);
+    EXPECT_EQ(v3.size("/items"), 2000u);
+}
+
+// Jsonable 객체와 변환
+TEST_F(PersistentTest, ConvertsWithJsonable) {
+    Profile profile;
+    profile.name = "choi";
+    profile.age = 28;
+
+    PersistentDocument doc;
+    ASSERT_TRUE(doc.parse(profile));
+    EXPECT_EQ(doc.getString("/name"), "choi");
+
+    PersistentDocument older = doc;
+    doc.setInt64("/age", 29);
+    Profile loaded;
+    doc.load(loaded);
+    EXPECT_EQ(loaded.age, 29);
+    older.load(loaded);
+    EXPECT_EQ(loaded.age, 28);
+}
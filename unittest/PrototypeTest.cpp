@@ -0,0 +1,154 @@
+/**
+ * PrototypeTest.cpp - 프로토타입 레지스트리 테스트
+ *
+ * 테스트 영역:
+ * - 정의 시 saveToJson 한 번, 복제/획득 시 saveToJson/loadFromJson 없음
+ * - 사본 수정이 프로토타입에 영향 없음
+ * - 반납 인스턴스 재사용과 풀 용량 제한
+ * - toJsonDocument: 획득한 뼈대를 saveToJson 없이 직렬화
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class PrototypeTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+int saveCount = 0;
+int loadCount = 0;
+
+class Skeleton : public Jsonable {
+public:
+    std::string version;
+    std::string status;
+    std::vector<std::string> links;
+
+    void loadFromJson() override {
+        ++loadCount;
+        version = getString("version");
+        status = getString("status");
+        links = getArray<std::string>("links");
+    }
+    void saveToJson() override {
+        ++saveCount;
+        setString("version", version);
+        setString("status", status);
+        setArray("links", links);
+    }
+};
+
+class Other : public Skeleton {};
+
+void defineSkeleton() {
+    Prototype<Skeleton>::define([](Skeleton& s) {
+        s.version = "2.1";
+        s.status = "ok";
+        s.links = {"/self", "/next"};
+    });
+}
+
+} // namespace
+
+TEST_F(PrototypeTest, CloneCopiesWithoutRebuilding) {
+    defineSkeleton();
+    ASSERT_TRUE(Prototype<Skeleton>::defined());
+
+    saveCount = 0;
+    loadCount = 0;
+    Skeleton copy = Prototype<Skeleton>::clone();
+    EXPECT_EQ(saveCount, 0);
+    EXPECT_EQ(loadCount, 0);
+    EXPECT_EQ(copy.version, "2.1");
+    EXPECT_EQ(copy.links.size(), 2u);
+
+    // document도 함께 복사됨
+    EXPECT_EQ(copy.getString("status"), "ok");
+    Prototype<Skeleton>::reset();
+}
+
+TEST_F(PrototypeTest, CopiesAreIndependent) {
+    defineSkeleton();
+    Skeleton first = Prototype<Skeleton>::clone();
+    first.status = "error";
+    first.links.push_back("/extra");
+    EXPECT_NE(first.toJson().find("error"), std::string::npos);
+
+    Skeleton second = Prototype<Skeleton>::clone();
+    EXPECT_EQ(second.status, "ok");
+    EXPECT_EQ(second.links.size(), 2u);
+    EXPECT_EQ(second.getString("status"), "ok");
+    Prototype<Skeleton>::reset();
+}
+
+TEST_F(PrototypeTest, AcquireRecyclesReleasedInstances) {
+    defineSkeleton();
+    Prototype<Skeleton>::setPoolCapacity(1);
+
+    Skeleton* address = nullptr;
+    {
+        auto handle = Prototype<Skeleton>::acquire();
+        ASSERT_TRUE(handle);
+        address = handle.get();
+        handle->status = "dirty";
+        handle->setString("extra", "x");
+    }
+    EXPECT_EQ(Prototype<Skeleton>::pooledCount(), 1u);
+
+    // 재사용 객체는 프로토타입 상태로 되돌아감
+    auto reused = Prototype<Skeleton>::acquire();
+    EXPECT_EQ(reused.get(), address);
+    EXPECT_EQ(reused->status, "ok");
+    EXPECT_FALSE(reused->hasKey("extra"));
+    EXPECT_EQ(Prototype<Skeleton>::pooledCount(), 0u);
+
+    // 용량 초과분은 해제
+    {
+        auto extra = Prototype<Skeleton>::acquire();
+        reused.reset();
+    }
+    EXPECT_EQ(Prototype<Skeleton>::pooledCount(), 1u);
+
+    Prototype<Skeleton>::reset();
+    EXPECT_EQ(Prototype<Skeleton>::pooledCount(), 0u);
+    Prototype<Skeleton>::setPoolCapacity(64);
+}
+
+TEST_F(PrototypeTest, SerializesDocumentWithoutSaving) {
+    defineSkeleton();
+    const std::string expected = R"({"version":"2.1","status":"ok","links":["/self","/next"]})";
+
+    saveCount = 0;
+    {
+        auto handle = Prototype<Skeleton>::acquire();
+        handle->setString("requestId", "r1");
+        EXPECT_EQ(handle->toJsonDocument(),
+                  R"({"version":"2.1","status":"ok","links":["/self","/next"],"requestId":"r1"})");
+    }
+
+    // 반납된 객체 재사용도 같음
+    auto reused = Prototype<Skeleton>::acquire();
+    EXPECT_EQ(reused->toJsonDocument(), expected);
+    EXPECT_EQ(Prototype<Skeleton>::clone().toJsonDocument(), expected);
+    EXPECT_EQ(saveCount, 0);
+
+    reused.reset();
+    Prototype<Skeleton>::reset();
+}
+
+TEST_F(PrototypeTest, RegistriesArePerType) {
+    Prototype<Other>::defineJson(R"({"version":"3","status":"other","links":[]})");
+    EXPECT_FALSE(Prototype<Skeleton>::defined());
+    EXPECT_FALSE(Prototype<Skeleton>::acquire());
+
+    Other other = Prototype<Other>::clone();
+    EXPECT_EQ(other.version, "3");
+    EXPECT_EQ(other.status, "other");
+    Prototype<Other>::reset();
+}
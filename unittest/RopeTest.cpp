@@ -0,0 +1,121 @@
+/**
+ * RopeTest.cpp - 청크 목록 출력 버퍼 테스트
+ *
+ * 테스트 영역:
+ * - toJson(RopeBuffer&) 결과가 toJson()과 동일
+ * - 커져도 이미 쓴 청크가 이동하지 않음
+ * - drain 순차 소비/중단, append/Push 경계
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class RopeTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+class Report : public Jsonable {
+public:
+    std::vector<std::string> lines;
+    std::vector<int64_t> counts;
+
+    void loadFromJson() override {
+        lines = getArray<std::string>("lines");
+        counts = getArray<int64_t>("counts");
+    }
+    void saveToJson() override {
+        setArray("lines", lines);
+        setArray("counts", counts);
+    }
+};
+
+Report makeReport(size_t count) {
+    Report report;
+    for (size_t i = 0; i < count; ++i) {
+        report.lines.push_back("line-" + std::to_string(i) + "-" + std::string(i % 40, 'z'));
+        report.counts.push_back(static_cast<int64_t>(i * 7919) - 100000);
+    }
+    return report;
+}
+
+} // namespace
+
+TEST_F(RopeTest, MatchesToJson) {
+    for (size_t count : {0u, 3u, 20000u}) {
+        Report report = makeReport(count);
+        RopeBuffer out;
+        ASSERT_TRUE(report.toJson(out));
+        const std::string expected = report.toJson();
+        EXPECT_EQ(out.size(), expected.size());
+        EXPECT_EQ(out.toString(), expected);
+    }
+}
+
+TEST_F(RopeTest, WrittenChunksNeverMove) {
+    RopeBuffer out;
+    out.Put('[');
+    const char* first = out.chunk(0).data();
+
+    Report report = makeReport(20000);
+    ASSERT_TRUE(report.toJson(out));
+    out.Put(']');
+
+    EXPECT_GT(out.chunkCount(), 3u);
+    EXPECT_EQ(out.chunk(0).data(), first);
+    EXPECT_EQ(out.toString(), "[" + report.toJson() + "]");
+
+    // 청크는 최대 크기까지만 커짐
+    for (size_t i = 0; i < out.chunkCount(); ++i) {
+        EXPECT_LE(out.chunk(i).size(), RopeBuffer::kMaxChunkSize);
+    }
+}
+
+TEST_F(RopeTest, DrainConsumesInOrder) {
+    Report report = makeReport(5000);
+    RopeBuffer out;
+    ASSERT_TRUE(report.toJson(out));
+    const std::string expected = out.toString();
+    const size_t chunks = out.chunkCount();
+    ASSERT_GT(chunks, 2u);
+
+    // 두 청크만 소비하고 중단
+    std::string received;
+    size_t taken = 0;
+    size_t consumed = out.drain([&](std::string_view piece) {
+        if (taken == 2) return false;
+        ++taken;
+        received.append(piece.data(), piece.size());
+        return true;
+    });
+    EXPECT_EQ(consumed, received.size());
+    EXPECT_EQ(out.chunkCount(), chunks - 2);
+    EXPECT_EQ(out.size(), expected.size() - consumed);
+
+    out.drain([&](std::string_view piece) { received.append(piece.data(), piece.size()); });
+    EXPECT_TRUE(out.empty());
+    EXPECT_EQ(out.chunkCount(), 0u);
+    EXPECT_EQ(received, expected);
+}
+
+TEST_F(RopeTest, AppendAndPushAcrossChunks) {
+    RopeBuffer out;
+    const std::string big(RopeBuffer::kInitialChunkSize * 3 + 17, 'a');
+    out.Put('x');
+    out.append(big.data(), big.size());
+    char* p = out.Push(5);
+    std::memcpy(p, "12345", 5);
+
+    EXPECT_EQ(out.size(), big.size() + 6);
+    EXPECT_EQ(out.toString(), "x" + big + "12345");
+
+    out.clear();
+    EXPECT_TRUE(out.empty());
+    out.append("ok", 2);
+    EXPECT_EQ(out.toString(), "ok");
+}
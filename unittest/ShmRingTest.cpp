@@ -0,0 +1,261 @@
+/**
+ * ShmRingTest.cpp - 공유 메모리 링 전송 테스트
+ *
+ * 테스트 영역:
+ * - 생성/연결/형식 검증
+ * - 송신 → 제자리 수신 왕복, 가득 참/비어 있음
+ * - 슬롯보다 큰 메시지 버림
+ * - 다중 송신/수신 스레드, 프로세스 간 전송 (fork)
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableShmRing.hpp"
+
+#if defined(JSONABLE_HAS_SHM_RING)
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <set>
+
+using namespace json;
+
+class ShmRingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        name_ = "/jsonable_ring_test_" + std::to_string(::getpid());
+        ShmRing::remove(name_);
+    }
+    void TearDown() override {
+        ShmRing::remove(name_);
+    }
+
+    std::string name_;
+};
+
+namespace {
+
+class Order : public Jsonable {
+public:
+    int64_t id = 0;
+    std::string symbol;
+    std::vector<int64_t> fills;
+
+    void loadFromJson() override {
+        id = getInt64("id");
+        symbol = getString("symbol");
+        fills = getArray<int64_t>("fills");
+    }
+    void saveToJson() override {
+        setInt64("id", id);
+        setString("symbol", symbol);
+        setArray("fills", fills);
+    }
+};
+
+Order makeOrder(int64_t id) {
+    Order order;
+    order.id = id;
+    order.symbol = "SYM-\"" + std::to_string(id % 7) + "\"";
+    for (int64_t i = 0; i < id % 5; ++i) order.fills.push_back(id * 10 + i);
+    return order;
+}
+
+class ThrowingOrder : public Order {
+public:
+    void saveToJson() override { throw std::runtime_error("save failed"); }
+};
+
+} // namespace
+
+// 생성과 연결
+TEST_F(ShmRingTest, CreateAndOpen) {
+    ShmRing ring;
+    EXPECT_FALSE(ring.create(name_, 3, 256));   // 2의 거듭제곱 아님
+    ASSERT_TRUE(ring.create(name_, 8, 256));
+    EXPECT_EQ(ring.slotCount(), 8u);
+    EXPECT_EQ(ring.slotSize(), 256u);
+
+    ShmRing duplicate;
+    EXPECT_FALSE(duplicate.create(name_, 8, 256));   // 같은 이름
+
+    ShmRing peer;
+    ASSERT_TRUE(peer.open(name_));
+    EXPECT_EQ(peer.slotCount(), 8u);
+
+    ShmRing missing;
+    EXPECT_FALSE(missing.open(name_ + "_missing"));
+    EXPECT_FALSE(missing.isOpen());
+    EXPECT_FALSE(missing.send("{}", 2));
+}
+
+// 왕복, 가득 참, 비어 있음, 버림
+TEST_F(ShmRingTest, SendReceiveRoundTrip) {
+    ShmRing rx;
+    ASSERT_TRUE(rx.create(name_, 4, 128));
+    ShmRing tx;
+    ASSERT_TRUE(tx.open(name_));
+
+    Order received;
+    EXPECT_FALSE(rx.receive(received));
+
+    for (int64_t id = 1; id <= 4; ++id) {
+        EXPECT_TRUE(tx.send(makeOrder(id)));
+    }
+    EXPECT_FALSE(tx.send(makeOrder(5)));   // 가득 참
+
+    for (int64_t id = 1; id <= 4; ++id) {
+        ASSERT_TRUE(rx.receive(received));
+        const Order expected = makeOrder(id);
+        EXPECT_EQ(received.id, expected.id);
+        EXPECT_EQ(received.symbol, expected.symbol);
+        EXPECT_EQ(received.fills, expected.fills);
+    }
+    EXPECT_FALSE(rx.receive(received));
+
+    // 슬롯보다 큰 메시지는 버려지고 다음 메시지는 정상 수신
+    Order big = makeOrder(6);
+    big.symbol.assign(200, 'x');
+    EXPECT_FALSE(tx.send(big));
+    EXPECT_TRUE(tx.send(makeOrder(7)));
+    ASSERT_TRUE(rx.receive(received));
+    EXPECT_EQ(received.id, 7);
+
+    // 원시 버퍼 방문
+    EXPECT_TRUE(tx.send("{\"id\":9}", 8));
+    std::string raw;
+    EXPECT_TRUE(rx.receiveRaw([&](char* json, size_t length) { raw.assign(json, length); }));
+    EXPECT_EQ(raw, "{\"id\":9}");
+}
+
+// 다중 송신자/수신자 (서로 다른 매핑)
+TEST_F(ShmRingTest, MultipleProducersAndConsumers) {
+    ShmRing owner;
+    ASSERT_TRUE(owner.create(name_, 64, 256));
+
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 2000;
+    std::atomic<int> consumed{0};
+    std::vector<std::vector<int64_t>> seen(kProducers);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            ShmRing tx;
+            ASSERT_TRUE(tx.open(name_));
+            for (int i = 0; i < kPerProducer; ++i) {
+                const Order order = makeOrder(p * kPerProducer + i);
+                while (!tx.send(order)) std::this_thread::yield();
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&, c] {
+            ShmRing rx;
+            ASSERT_TRUE(rx.open(name_));
+            std::vector<int64_t> local;
+            Order order;
+            while (consumed.load() < kProducers * kPerProducer) {
+                if (rx.receive(order)) {
+                    local.push_back(order.id);
+                    consumed.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            seen[c] = std::move(local);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    std::set<int64_t> ids;
+    for (const auto& list : seen) ids.insert(list.begin(), list.end());
+    EXPECT_EQ(ids.size(), static_cast<size_t>(kProducers * kPerProducer));
+    EXPECT_EQ(*ids.rbegin(), kProducers * kPerProducer - 1);
+}
+
+// 프로세스 간 전송
+TEST_F(ShmRingTest, CrossProcess) {
+    ShmRing rx;
+    ASSERT_TRUE(rx.create(name_, 16, 256));
+
+    constexpr int kCount = 500;
+    const pid_t child = ::fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        ShmRing tx;
+        if (!tx.open(name_)) ::_exit(1);
+        for (int i = 0; i < kCount; ++i) {
+            const Order order = makeOrder(i);
+            while (!tx.send(order)) std::this_thread::yield();
+        }
+        ::_exit(0);
+    }
+
+    Order order;
+    for (int i = 0; i < kCount; ++i) {
+        while (!rx.receive(order)) std::this_thread::yield();
+        ASSERT_EQ(order.id, i);
+        ASSERT_EQ(order.symbol, makeOrder(i).symbol);
+    }
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+// 사용자 코드 예외: 확보한 슬롯은 공개/반환되어 링이 계속 동작
+TEST_F(ShmRingTest, ThrowingUserCodeReleasesSlot) {
+    ShmRing ring;
+    ASSERT_TRUE(ring.create(name_, 2, 256));
+
+    ThrowingOrder broken;
+    Order received;
+    for (int round = 0; round < 2; ++round) {
+        EXPECT_THROW(ring.send(broken), std::runtime_error);
+        EXPECT_THROW(ring.send(broken), std::runtime_error);
+        // 버림 표시된 슬롯은 수신 측이 건너뛰며 반환
+        EXPECT_FALSE(ring.receive(received));
+    }
+
+    ASSERT_TRUE(ring.send(makeOrder(1)));
+    ASSERT_TRUE(ring.send(makeOrder(2)));
+    EXPECT_THROW(ring.receiveRaw([](char*, size_t) { throw std::runtime_error("visit failed"); }),
+                 std::runtime_error);
+
+    // 예외로 빠져나간 슬롯도 반환되어 다시 송신 가능
+    ASSERT_TRUE(ring.send(makeOrder(3)));
+    ASSERT_TRUE(ring.receive(received));
+    EXPECT_EQ(received.id, 2);
+    ASSERT_TRUE(ring.receive(received));
+    EXPECT_EQ(received.id, 3);
+    EXPECT_FALSE(ring.receive(received));
+}
+
+// 손상된 헤더: 슬롯 수가 0이거나 2의 거듭제곱이 아니면 연결 거부
+TEST_F(ShmRingTest, OpenRejectsBadSlotCount) {
+    ShmRing ring;
+    ASSERT_TRUE(ring.create(name_, 8, 256));
+
+    const int fd = ::shm_open(name_.c_str(), O_RDWR, 0);
+    ASSERT_GE(fd, 0);
+    auto* header = static_cast<detail::ShmRingHeader*>(
+        ::mmap(nullptr, sizeof(detail::ShmRingHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+    ::close(fd);
+    ASSERT_NE(static_cast<void*>(header), MAP_FAILED);
+
+    for (uint32_t bad : {0u, 1u, 3u, 6u}) {
+        header->slotCount = bad;
+        ShmRing peer;
+        EXPECT_FALSE(peer.open(name_)) << bad;
+    }
+    header->slotCount = 8;
+    ShmRing peer;
+    EXPECT_TRUE(peer.open(name_));
+    ::munmap(header, sizeof(detail::ShmRingHeader));
+}
+
+#endif // JSONABLE_HAS_SHM_RING
@@ -0,0 +1,148 @@
+/**
+ * StaticJsonTest.cpp - 컴파일 타임 JSON 리터럴 테스트
+ *
+ * 테스트 영역:
+ * - constexpr 조회 (static_assert)
+ * - 이스케이프/유니코드/큰 정수/실수 원문 보존
+ * - Jsonable 로드 결과가 fromJson과 동일한지
+ * - 런타임 생성 시 잘못된 리터럴 거부
+ *
+ * 잘못된 리터럴로 constexpr 변수를 만들면 컴파일 오류가 나므로 여기서는 런타임 경로만 확인
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class StaticJsonTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+constexpr char kConfigText[] = R"({
+    "name": "gateway",
+    "port": 8080,
+    "ratio": 0.25,
+    "debug": false,
+    "offset": -42,
+    "big": 18446744073709551615,
+    "hosts": ["a.internal", "b.internal"],
+    "weights": [1, 2, 3],
+    "retry": {"count": 3, "backoff": 1.5e-1},
+    "escaped": "tab\there \"q\" \u00e9 \ud83d\ude00",
+    "none": null
+})";
+
+constexpr auto kConfig = fromLiteral<staticNodeCount(kConfigText)>(kConfigText);
+
+static_assert(kConfig.valid(), "literal must parse");
+static_assert(kConfig.getInt64("port") == 8080, "root getter");
+static_assert(kConfig.getString("name") == "gateway", "string getter");
+static_assert(kConfig.getUInt64("big") == 18446744073709551615ULL, "20-digit integer");
+static_assert(kConfig.getInt64("offset") == -42, "negative integer");
+static_assert(kConfig.getDouble("ratio") == 0.25, "double");
+static_assert(!kConfig.getBool("debug", true), "bool");
+static_assert(kConfig["hosts"].size() == 2, "array size");
+static_assert(kConfig["hosts"][1].asString() == "b.internal", "array element");
+static_assert(kConfig["retry"]["count"].asInt64() == 3, "nested member");
+static_assert(kConfig["none"].isNull(), "null");
+static_assert(!kConfig.hasKey("missing"), "missing key");
+
+constexpr auto kEmpty = JSONABLE_JSON_LITERAL("[]");
+static_assert(kEmpty.root().isArray() && kEmpty.root().size() == 0, "empty array");
+
+class Config : public Jsonable {
+public:
+    std::string name;
+    int64_t port = 0;
+    double backoff = 0.0;
+    std::vector<std::string> hosts;
+    std::vector<int64_t> weights;
+
+    void loadFromJson() override {
+        name = getString("name");
+        port = getInt64("port");
+        hosts = getArray<std::string>("hosts");
+        weights = getArray<int64_t>("weights");
+        if (hasKey("retry")) {
+            iterateObject("retry", [this](const std::string& key) {
+                if (key == "backoff") backoff = getDouble(key.c_str());
+            });
+        }
+    }
+    void saveToJson() override {
+        setString("name", name);
+        setInt64("port", port);
+        setArray("hosts", hosts);
+        setArray("weights", weights);
+    }
+};
+
+} // namespace
+
+// 이스케이프/숫자 원문
+TEST_F(StaticJsonTest, DecodesStringsAndKeepsNumberText) {
+    EXPECT_EQ(kConfig.getString("escaped"), "tab\there \"q\" \xC3\xA9 \xF0\x9F\x98\x80");
+    EXPECT_EQ(kConfig["retry"]["backoff"].numberText(), "1.5e-1");
+    EXPECT_DOUBLE_EQ(kConfig["retry"]["backoff"].asDouble(), 0.15);
+    EXPECT_EQ(kConfig["retry"][0].key(), "count");
+    EXPECT_FALSE(kConfig["hosts"][5].exists());
+    EXPECT_EQ(kConfig["hosts"]["x"].asString("d"), "d");
+}
+
+// Jsonable 로드 결과 == fromJson 결과
+TEST_F(StaticJsonTest, LoadMatchesFromJson) {
+    Config parsed;
+    parsed.fromJson(kConfigText);
+    Config loaded;
+    kConfig.load(loaded);
+
+    EXPECT_EQ(loaded.name, "gateway");
+    EXPECT_EQ(loaded.port, 8080);
+    EXPECT_EQ(loaded.hosts, parsed.hosts);
+    EXPECT_EQ(loaded.weights, std::vector<int64_t>({1, 2, 3}));
+    EXPECT_EQ(loaded.getUInt64("big"), parsed.getUInt64("big"));
+    EXPECT_EQ(loaded.getString("escaped"), parsed.getString("escaped"));
+    EXPECT_EQ(loaded.toJson(), parsed.toJson());
+}
+
+// 출력 JSON은 다시 파싱해도 같은 값
+TEST_F(StaticJsonTest, ToJsonRoundTrips) {
+    const std::string text = kConfig.toJson();
+    EXPECT_EQ(text.find('\n'), std::string::npos);
+
+    Config fromText;
+    fromText.fromJson(text);
+    Config parsed;
+    parsed.fromJson(kConfigText);
+    EXPECT_EQ(fromText.toJson(), parsed.toJson());
+    EXPECT_EQ(kEmpty.toJson(), "[]");
+}
+
+// 런타임 생성: 잘못된 리터럴은 valid() == false
+TEST_F(StaticJsonTest, RejectsMalformedAtRuntime) {
+    static const char kBadTrailing[] = "{\"a\":1} x";
+    static const char kBadNumber[] = "[01]";
+    static const char kBadEscape[] = "[\"\\x\"]";
+    static const char kBadSurrogate[] = "[\"\\udc00\"]";
+    static const char kBadComma[] = "{\"a\":1,}";
+
+    EXPECT_FALSE((StaticJson<2, sizeof(kBadTrailing)>(kBadTrailing).valid()));
+    EXPECT_FALSE((StaticJson<2, sizeof(kBadNumber)>(kBadNumber).valid()));
+    EXPECT_FALSE((StaticJson<2, sizeof(kBadEscape)>(kBadEscape).valid()));
+    EXPECT_FALSE((StaticJson<2, sizeof(kBadSurrogate)>(kBadSurrogate).valid()));
+    EXPECT_FALSE((StaticJson<2, sizeof(kBadComma)>(kBadComma).valid()));
+    EXPECT_FALSE((StaticJson<2, sizeof(kBadComma)>(kBadComma).root().exists()));
+}
+
+// 노드 수를 잘못 지정하면 넘치지 않고 거부
+TEST_F(StaticJsonTest, RejectsWrongNodeCount) {
+    static const char kText[] = "[1,2,3,4]";
+    EXPECT_FALSE((StaticJson<2, sizeof(kText)>(kText).valid()));
+    EXPECT_FALSE((StaticJson<9, sizeof(kText)>(kText).valid()));
+    EXPECT_TRUE((StaticJson<5, sizeof(kText)>(kText).valid()));
+}
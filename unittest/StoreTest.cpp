@@ -0,0 +1,283 @@
+/**
+ * StoreTest.cpp - append-only 레코드 저장소 테스트
+ *
+ * 테스트 영역:
+ * - put/get/remove 및 덮어쓰기
+ * - 색인 스냅샷 + 꼬리 스캔 재시작, 색인 없는 전체 스캔
+ * - 쓰기 중 중단된 꼬리 잘라내기
+ * - 압축 (동기/백그라운드, 압축 중 쓰기, 압축 중 닫기/다시 열기)
+ * - 체크섬이 맞지 않는 레코드 읽기 거부
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include "../JsonableStore.hpp"
+
+#if defined(JSONABLE_HAS_STORE)
+
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <unistd.h>
+
+using namespace json;
+
+class StoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = "/tmp/jsonable_store_test_" + std::to_string(::getpid()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        cleanup();
+    }
+    void TearDown() override { cleanup(); }
+
+    void cleanup() {
+        ::unlink(path_.c_str());
+        ::unlink((path_ + ".idx").c_str());
+    }
+
+    std::string path_;
+};
+
+namespace {
+
+class Account : public Jsonable {
+public:
+    std::string name;
+    int64_t balance = 0;
+
+    Account() = default;
+    Account(std::string n, int64_t b) : name(std::move(n)), balance(b) {}
+
+    void loadFromJson() override {
+        name = getString("name");
+        balance = getInt64("balance");
+    }
+    void saveToJson() override {
+        setString("name", name);
+        setInt64("balance", balance);
+    }
+};
+
+Account load(const RecordStore& store, uint64_t id) {
+    Account account;
+    EXPECT_TRUE(store.get(id, account)) << id;
+    return account;
+}
+
+} // namespace
+
+// 기본 put/get/remove
+TEST_F(StoreTest, PutGetRemove) {
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_TRUE(store.put(1, Account("alice", 100)));
+    EXPECT_TRUE(store.put(2, Account("bob", -5)));
+    EXPECT_TRUE(store.put(1, Account("alice", 150)));
+
+    EXPECT_EQ(store.size(), 2u);
+    EXPECT_EQ(load(store, 1).balance, 150);
+    EXPECT_EQ(load(store, 2).name, "bob");
+
+    EXPECT_TRUE(store.remove(2));
+    EXPECT_FALSE(store.remove(2));
+    EXPECT_FALSE(store.contains(2));
+    Account missing("unchanged", 1);
+    EXPECT_FALSE(store.get(2, missing));
+    EXPECT_EQ(missing.name, "unchanged");
+    EXPECT_GT(store.garbageRatio(), 0.0);
+}
+
+// 색인 스냅샷 이후 덧붙은 레코드도 재시작 시 복원
+TEST_F(StoreTest, RestoreFromIndexAndTail) {
+    std::string flushedIndex;
+    {
+        RecordStore store;
+        ASSERT_TRUE(store.open(path_));
+        for (uint64_t id = 0; id < 50; ++id) store.put(id, Account("user" + std::to_string(id), id));
+        ASSERT_TRUE(store.flush());
+        std::ifstream in(path_ + ".idx", std::ios::binary);
+        flushedIndex.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+        store.put(7, Account("seven", 777));
+        store.remove(8);
+        store.put(100, Account("late", 1));
+    }
+    // 소멸자가 저장한 색인을 flush 시점 색인으로 되돌림 (중단된 프로세스 흉내)
+    std::ofstream(path_ + ".idx", std::ios::binary | std::ios::trunc) << flushedIndex;
+
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_EQ(store.size(), 50u);
+    EXPECT_EQ(load(store, 7).balance, 777);
+    EXPECT_FALSE(store.contains(8));
+    EXPECT_EQ(load(store, 100).name, "late");
+    EXPECT_EQ(load(store, 49).name, "user49");
+}
+
+// 색인 파일이 없거나 맞지 않으면 전체 스캔
+TEST_F(StoreTest, RestoreWithoutIndex) {
+    {
+        RecordStore store;
+        ASSERT_TRUE(store.open(path_));
+        store.put(1, Account("a", 1));
+        store.put(2, Account("b", 2));
+        store.put(1, Account("a", 3));
+        store.remove(2);
+    }
+    std::ofstream(path_ + ".idx", std::ios::trunc) << "garbage";
+
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_EQ(store.ids(), std::vector<uint64_t>({1}));
+    EXPECT_EQ(load(store, 1).balance, 3);
+}
+
+// 중단된 쓰기(잘린 프레임)는 버리고 이어서 쓰기 가능
+TEST_F(StoreTest, TruncatedTailIsDropped) {
+    uint64_t validSize;
+    {
+        RecordStore store;
+        ASSERT_TRUE(store.open(path_));
+        store.put(1, Account("kept", 1));
+        validSize = store.fileSize();
+        store.put(2, Account("torn", 2));
+    }
+    ::unlink((path_ + ".idx").c_str());
+    ASSERT_EQ(::truncate(path_.c_str(), static_cast<off_t>(validSize + 10)), 0);
+
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_EQ(store.fileSize(), validSize);
+    EXPECT_FALSE(store.contains(2));
+    EXPECT_TRUE(store.put(3, Account("after", 3)));
+    store.close();
+
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_EQ(store.ids(), std::vector<uint64_t>({1, 3}));
+}
+
+// 압축 후 크기 감소, 내용 유지, 재시작 가능
+TEST_F(StoreTest, CompactRemovesGarbage) {
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    for (int round = 0; round < 5; ++round) {
+        for (uint64_t id = 0; id < 20; ++id) store.put(id, Account("acct", round * 100 + id));
+    }
+    for (uint64_t id = 10; id < 20; ++id) store.remove(id);
+
+    const uint64_t before = store.fileSize();
+    ASSERT_TRUE(store.compact());
+    EXPECT_LT(store.fileSize(), before);
+    EXPECT_DOUBLE_EQ(store.garbageRatio(), 0.0);
+    for (uint64_t id = 0; id < 10; ++id) EXPECT_EQ(load(store, id).balance, static_cast<int64_t>(400 + id));
+
+    store.put(3, Account("post", 1));
+    store.close();
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_EQ(store.size(), 10u);
+    EXPECT_EQ(load(store, 3).name, "post");
+    EXPECT_EQ(load(store, 9).balance, 409);
+}
+
+// 백그라운드 압축 중에도 쓰기/읽기 유지
+TEST_F(StoreTest, BackgroundCompactionWithConcurrentWrites) {
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    for (uint64_t id = 0; id < 200; ++id) {
+        store.put(id, Account("old", 0));
+        store.put(id, Account("mid", 1));
+    }
+
+    ASSERT_TRUE(store.compactAsync());
+    for (uint64_t id = 0; id < 200; id += 2) store.put(id, Account("new", 2));
+    for (uint64_t id = 1; id < 200; id += 10) store.remove(id);
+    store.waitForCompaction();
+
+    for (uint64_t id = 0; id < 200; ++id) {
+        if (id % 10 == 1) {
+            EXPECT_FALSE(store.contains(id)) << id;
+        } else {
+            EXPECT_EQ(load(store, id).balance, id % 2 == 0 ? 2 : 1) << id;
+        }
+    }
+
+    store.close();
+    ASSERT_TRUE(store.open(path_));
+    EXPECT_EQ(store.size(), 180u);
+    EXPECT_EQ(load(store, 198).name, "new");
+}
+
+// 본문이 바뀐 레코드는 체크섬 불일치로 읽지 않음
+TEST_F(StoreTest, GetRejectsChecksumMismatch) {
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    store.put(1, Account("alice", 100));
+    const uint64_t second = store.fileSize();
+    store.put(2, Account("bob", 200));
+
+    // 두 번째 레코드 JSON의 마지막 바이트('}') 변경
+    std::string corrupt;
+    ASSERT_TRUE(store.getJson(2, corrupt));
+    {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(second + 24 + corrupt.size() - 1));
+        file.put(']');
+    }
+
+    std::string jsonStr;
+    EXPECT_FALSE(store.getJson(2, jsonStr));
+    Account account("unchanged", 7);
+    EXPECT_FALSE(store.get(2, account));
+    EXPECT_EQ(account.name, "unchanged");
+    EXPECT_EQ(load(store, 1).balance, 100);
+}
+
+// 압축이 도는 동안 close/open을 반복해도 기존 파일을 덮어쓰지 않음
+TEST_F(StoreTest, CloseAndReopenWaitForCompaction) {
+    const std::string other = path_ + "_other";
+    {
+        RecordStore seed;
+        ASSERT_TRUE(seed.open(other));
+        seed.put(1000, Account("other", 1));
+    }
+
+    RecordStore store;
+    ASSERT_TRUE(store.open(path_));
+    for (uint64_t id = 0; id < 100; ++id) {
+        store.put(id, Account("old", 0));
+        store.put(id, Account("acct", static_cast<int64_t>(id)));
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread compactor([&] {
+        while (!stop.load()) {
+            store.compact();
+            store.compactAsync();
+        }
+    });
+    for (int round = 0; round < 50; ++round) {
+        ASSERT_TRUE(store.open(round % 2 ? other : path_));
+        store.put(5000 + round, Account("round", round));
+    }
+    stop.store(true);
+    compactor.join();
+    store.close();
+
+    RecordStore check;
+    ASSERT_TRUE(check.open(path_));
+    for (uint64_t id = 0; id < 100; ++id) EXPECT_EQ(load(check, id).balance, static_cast<int64_t>(id)) << id;
+    EXPECT_FALSE(check.contains(1000));
+    EXPECT_EQ(check.size(), 125u);
+    ASSERT_TRUE(check.open(other));
+    EXPECT_EQ(load(check, 1000).name, "other");
+    EXPECT_FALSE(check.contains(0));
+    EXPECT_EQ(check.size(), 26u);
+    check.close();
+
+    ::unlink(other.c_str());
+    ::unlink((other + ".idx").c_str());
+}
+
+#endif // JSONABLE_HAS_STORE
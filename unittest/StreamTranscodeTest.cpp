@@ -0,0 +1,197 @@
+/**
+ * StreamTranscodeTest.cpp - document 없는 스트림 변환 테스트
+ *
+ * 테스트 영역:
+ * - compact ↔ pretty 왕복 및 숫자 원문 보존
+ * - 최상위 배열 → NDJSON → 배열 왕복
+ * - 잘못된 입력 / 루트가 배열이 아닌 경우
+ * - 출력 스트림 쓰기 실패
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+#include <algorithm>
+#include <sstream>
+#include <streambuf>
+
+using namespace json;
+
+class StreamTranscodeTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+namespace {
+
+// limit 바이트까지만 받고 이후 쓰기는 실패하는 출력 버퍼
+class LimitedBuf : public std::streambuf {
+public:
+    explicit LimitedBuf(size_t limit) : limit_(limit) {}
+    std::string data;
+
+protected:
+    int_type overflow(int_type c) override {
+        if (traits_type::eq_int_type(c, traits_type::eof())) return traits_type::not_eof(c);
+        if (data.size() >= limit_) return traits_type::eof();
+        data.push_back(traits_type::to_char_type(c));
+        return c;
+    }
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        const size_t room = limit_ - std::min(limit_, data.size());
+        const size_t count = std::min(room, static_cast<size_t>(n));
+        data.append(s, count);
+        return static_cast<std::streamsize>(count);
+    }
+
+private:
+    size_t limit_;
+};
+
+} // namespace
+
+// compact ↔ pretty 왕복
+TEST_F(StreamTranscodeTest, CompactPrettyRoundTrip) {
+    const std::string compact =
+        "{\"name\":\"a \\\"quoted\\\" name\",\"values\":[1,2.50,-0,1e3,12345678901234567890123],"
+        "\"nested\":{\"empty\":{},\"list\":[]},\"flag\":true,\"none\":null}";
+
+    std::istringstream compactIn(compact);
+    std::ostringstream prettyOut;
+    ASSERT_TRUE(prettyStream(compactIn, prettyOut, 2));
+
+    const std::string pretty = prettyOut.str();
+    EXPECT_NE(pretty.find("\n  \"name\": "), std::string::npos);
+    EXPECT_GT(pretty.size(), compact.size());
+
+    std::istringstream prettyIn(pretty);
+    std::ostringstream compactOut;
+    ASSERT_TRUE(compactStream(prettyIn, compactOut));
+
+    // 숫자는 원문 표기 그대로 (2.50, -0, 1e3, 큰 정수)
+    EXPECT_EQ(compactOut.str(), compact);
+
+    // minify 결과와도 동일
+    std::string minified = pretty;
+    minify(minified);
+    EXPECT_EQ(minified, compact);
+}
+
+// 배열 → NDJSON → 배열
+TEST_F(StreamTranscodeTest, ArrayNdjsonRoundTrip) {
+    std::string array = "[";
+    for (int i = 0; i < 5000; ++i) {
+        if (i > 0) array += ",";
+        array += i % 3 == 0 ? "{\"id\":" + std::to_string(i) + ",\"tags\":[\"x\",\"y\"]}"
+               : i % 3 == 1 ? "[" + std::to_string(i) + ",null]"
+                            : "\"s" + std::to_string(i) + "\"";
+    }
+    array += "]";
+
+    std::istringstream arrayIn(array);
+    std::ostringstream ndjsonOut;
+    ASSERT_TRUE(arrayToNdjson(arrayIn, ndjsonOut));
+
+    const std::string ndjson = ndjsonOut.str();
+    std::istringstream lines(ndjson);
+    std::string line;
+    size_t count = 0;
+    while (std::getline(lines, line)) {
+        if (count < 3) {
+            const char* expected[] = {"{\"id\":0,\"tags\":[\"x\",\"y\"]}", "[1,null]", "\"s2\""};
+            EXPECT_EQ(line, expected[count]);
+        }
+        ++count;
+    }
+    EXPECT_EQ(count, 5000u);
+
+    // 빈 줄과 CRLF가 섞여 있어도 결합 가능
+    std::istringstream ndjsonIn("\r\n" + ndjson + "\n\n");
+    std::ostringstream arrayOut;
+    ASSERT_TRUE(ndjsonToArray(ndjsonIn, arrayOut));
+    EXPECT_EQ(arrayOut.str(), array);
+}
+
+// 빈 입력 / 잘못된 입력
+TEST_F(StreamTranscodeTest, EdgeCasesAndErrors) {
+    std::istringstream emptyArray("[ ]");
+    std::ostringstream emptyNdjson;
+    EXPECT_TRUE(arrayToNdjson(emptyArray, emptyNdjson));
+    EXPECT_TRUE(emptyNdjson.str().empty());
+
+    std::istringstream noLines("");
+    std::ostringstream joined;
+    EXPECT_TRUE(ndjsonToArray(noLines, joined));
+    EXPECT_EQ(joined.str(), "[]");
+
+    std::istringstream objectRoot("{\"a\":1}");
+    std::ostringstream ignored;
+    EXPECT_FALSE(arrayToNdjson(objectRoot, ignored));
+
+    std::istringstream broken("{\"a\":[1,2}");
+    std::ostringstream partial;
+    EXPECT_FALSE(compactStream(broken, partial));
+
+    std::istringstream brokenLine("{\"a\":1}\n{\"b\":\n");
+    std::ostringstream partialArray;
+    EXPECT_FALSE(ndjsonToArray(brokenLine, partialArray));
+    // 한 줄에 값 여러 개는 NDJSON이 아님
+    std::istringstream twoPerLine("{\"a\":1} {\"b\":2}\n");
+    std::ostringstream rejected;
+    EXPECT_FALSE(ndjsonToArray(twoPerLine, rejected));
+}
+
+TEST_F(StreamTranscodeTest, NestedArrayElements) {
+    // 요소 자체가 배열이어도 줄마다 새 루트로 출력
+    std::istringstream arrayIn("[[1,2],[3],[],[[4]],{\"a\":[5]}]");
+    std::ostringstream ndjsonOut;
+    ASSERT_TRUE(arrayToNdjson(arrayIn, ndjsonOut));
+    EXPECT_EQ(ndjsonOut.str(), "[1,2]\n[3]\n[]\n[[4]]\n{\"a\":[5]}\n");
+
+    std::istringstream ndjsonIn(ndjsonOut.str());
+    std::ostringstream arrayOut;
+    ASSERT_TRUE(ndjsonToArray(ndjsonIn, arrayOut));
+    EXPECT_EQ(arrayOut.str(), "[[1,2],[3],[],[[4]],{\"a\":[5]}]");
+}
+
+// 출력 스트림 쓰기 실패는 false (입력이 정상이어도)
+TEST_F(StreamTranscodeTest, OutputWriteFailure) {
+    std::string array = "[";
+    for (int i = 0; i < 20000; ++i) array += (i ? ",{\"id\":" : "{\"id\":") + std::to_string(i) + "}";
+    array += "]";
+
+    // 버퍼(64 KiB)를 넘는 출력 중간에 실패
+    {
+        LimitedBuf buf(1000);
+        std::ostream out(&buf);
+        std::istringstream in(array);
+        EXPECT_FALSE(compactStream(in, out));
+        EXPECT_TRUE(out.fail());
+    }
+    {
+        LimitedBuf buf(1000);
+        std::ostream out(&buf);
+        std::istringstream in(array);
+        EXPECT_FALSE(arrayToNdjson(in, out));
+    }
+    // 마지막 기록(finish)에서만 실패
+    {
+        LimitedBuf buf(4);
+        std::ostream out(&buf);
+        std::istringstream in("{\"a\":1}");
+        EXPECT_FALSE(prettyStream(in, out));
+    }
+    {
+        LimitedBuf buf(4);
+        std::ostream out(&buf);
+        std::istringstream in("{\"a\":1}\n{\"b\":2}\n");
+        EXPECT_FALSE(ndjsonToArray(in, out));
+    }
+
+    // 충분하면 성공
+    LimitedBuf buf(1 << 20);
+    std::ostream out(&buf);
+    std::istringstream in(array);
+    EXPECT_TRUE(compactStream(in, out));
+    EXPECT_EQ(buf.data, array);
+}
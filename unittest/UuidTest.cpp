@@ -0,0 +1,100 @@
+/**
+ * UuidTest.cpp - UUID 필드 테스트
+ *
+ * 테스트 영역:
+ * - 포맷/파싱 왕복 (모든 nibble 값, 대소문자)
+ * - setUuid/getUuid (루트 / 배열 컨텍스트)
+ * - 잘못된 형식 거부
+ */
+
+#include <gtest/gtest.h>
+#include "../Jsonable.hpp"
+
+using namespace json;
+
+class UuidTest : public ::testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+// 포맷/파싱 왕복
+TEST_F(UuidTest, FormatAndParse) {
+    Uuid uuid = {0x12, 0x3e, 0x45, 0x67, 0xe8, 0x9b, 0x12, 0xd3,
+                 0xa4, 0x56, 0x42, 0x66, 0x14, 0x17, 0x40, 0x00};
+    EXPECT_EQ(uuidToString(uuid), "123e4567-e89b-12d3-a456-426614174000");
+
+    Uuid parsed{};
+    ASSERT_TRUE(parseUuid("123E4567-E89B-12D3-A456-426614174000", parsed));
+    EXPECT_EQ(parsed, uuid);
+
+    // 모든 바이트 값이 왕복되는지
+    for (int base = 0; base < 256; base += 16) {
+        Uuid bytes;
+        for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = static_cast<uint8_t>(base + i);
+        Uuid roundTrip{};
+        ASSERT_TRUE(parseUuid(uuidToString(bytes), roundTrip));
+        EXPECT_EQ(roundTrip, bytes);
+    }
+}
+
+// 잘못된 형식
+TEST_F(UuidTest, RejectsMalformedText) {
+    const Uuid sentinel = {1, 2, 3};
+    const char* invalid[] = {
+        "",
+        "123e4567e89b12d3a456426614174000",
+        "123e4567-e89b-12d3-a456-42661417400",
+        "123e4567-e89b-12d3-a456-4266141740000",
+        "123e4567-e89b-12d3-a456_426614174000",
+        "123e4567-e89b-12d3-a456-42661417400g",
+        "g23e4567-e89b-12d3-a456-426614174000",
+        "123e4567-e89b-12d3-a4-5426614174000",
+        "{23e4567-e89b-12d3-a456-42661417400}",
+    };
+    for (const char* text : invalid) {
+        Uuid out = sentinel;
+        EXPECT_FALSE(parseUuid(text, out)) << text;
+        EXPECT_EQ(out, sentinel) << text;
+    }
+}
+
+// Jsonable 필드
+TEST_F(UuidTest, JsonableFields) {
+    class Entity : public Jsonable {
+    public:
+        Uuid id{};
+        Uuid owner{};
+        std::vector<Uuid> links;
+
+        void loadFromJson() override {
+            id = getUuid("id");
+            owner = getUuid("owner", id);
+        }
+        void saveToJson() override {
+            setUuid("id", id);
+            beginArray("links");
+            for (const auto& link : links) setUuid("", link);
+            endArray();
+        }
+    };
+
+    Entity entity;
+    ASSERT_TRUE(parseUuid("00000000-0000-0000-0000-0000000000ff", entity.id));
+    entity.links.push_back(entity.id);
+    entity.links.push_back(Uuid{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff});
+
+    std::string json = entity.toJson();
+    EXPECT_EQ(json, "{\"id\":\"00000000-0000-0000-0000-0000000000ff\",\"links\":["
+                    "\"00000000-0000-0000-0000-0000000000ff\",\"ffffffff-ffff-ffff-ffff-ffffffffffff\"]}");
+
+    Entity loaded;
+    loaded.fromJson(json);
+    EXPECT_EQ(loaded.id, entity.id);
+    EXPECT_EQ(loaded.owner, entity.id);   // 없는 키: 기본값
+
+    Entity invalid;
+    invalid.fromJson("{\"id\":\"not-a-uuid\"}");
+    EXPECT_EQ(invalid.id, Uuid{});
+}